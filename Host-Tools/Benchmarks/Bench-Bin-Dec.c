@@ -0,0 +1,109 @@
+/*==============================================================================
+ Benchmark: Bench-Bin-Dec
+ Date:      October 17, 2026
+
+ Compares the cost of bin8_to_ascii() and bin16_to_ascii() with the repeated
+ subtraction bin_to_dec() function of the main program (copied below), in
+ host instructions, for every 8-bit value and every 61st 16-bit value (and
+ 65535). Host instructions show how the cost changes with the value, and the
+ relative cost of the functions, but they are not PIC instruction cycles -
+ use the MPLAB X stopwatch for those.
+==============================================================================*/
+
+#include    <stdio.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "Bin-Dec.h"
+
+unsigned char dec0;
+unsigned char dec1;
+unsigned char dec2;
+
+// bin_to_dec() from Intro-5-Analog-Input.c
+void bin_to_dec(unsigned char bin)
+{
+    dec0 = bin;             // Store number in ones digit
+    dec1 = 0;               // Clear tens digit
+    dec2 = 0;               // Clear hundreds digit
+    
+    // Count hundreds digits in dec2 variable
+    while(dec0 >= 100)
+    {
+        dec2 ++;
+        dec0 = dec0 - 100;
+    }
+    // Count tens digits in dec1 variable, dec0 will contain remaining ones
+    while(dec0 >= 10)
+    {
+        dec1 ++;
+        dec0 = dec0 - 10;
+    }
+}
+
+typedef struct
+{
+    unsigned long minimum;
+    unsigned long maximum;
+    unsigned long long total;
+    unsigned long count;
+} cost_t;
+
+static void add_cost(cost_t *cost, unsigned long instructions)
+{
+    if(cost->count == 0 || instructions < cost->minimum)
+    {
+        cost->minimum = instructions;
+    }
+    if(instructions > cost->maximum)
+    {
+        cost->maximum = instructions;
+    }
+    cost->total += instructions;
+    cost->count ++;
+}
+
+static void print_cost(const char *name, const cost_t *cost)
+{
+    printf("%-16s %8lu %8.1f %8lu\n", name, cost->minimum,
+            (double)cost->total / cost->count, cost->maximum);
+}
+
+int main(void)
+{
+    cost_t old = {0}, bin8 = {0}, bin16 = {0};
+    unsigned char digits[5];
+    unsigned long value;
+    bool correct = true;
+
+    for(unsigned int value = 0; value != 256; value++)
+    {
+        sim_count_start();
+        bin_to_dec((unsigned char)value);
+        add_cost(&old, sim_count_stop());
+
+        sim_count_start();
+        bin8_to_ascii((unsigned char)value, digits);
+        add_cost(&bin8, sim_count_stop());
+        correct = correct && (digits[0] - '0' == dec2 && digits[1] - '0' == dec1 && digits[2] - '0' == dec0);
+    }
+    for(value = 0; value < 65536; value = (value == 65535) ? 65536 : (value + 61 < 65536) ? value + 61 : 65535)
+    {
+        sim_count_start();
+        bin16_to_ascii((unsigned int)value, digits);
+        add_cost(&bin16, sim_count_stop());
+        correct = correct && ((digits[0] - '0') * 10000UL + (digits[1] - '0') * 1000 +
+                (digits[2] - '0') * 100 + (digits[3] - '0') * 10 + (digits[4] - '0') == value);
+    }
+
+    printf("Host instructions per conversion\n");
+    printf("%-16s %8s %8s %8s\n", "Function", "Minimum", "Average", "Maximum");
+    print_cost("bin_to_dec", &old);
+    print_cost("bin8_to_ascii", &bin8);
+    print_cost("bin16_to_ascii", &bin16);
+    sim_check(correct, "conversions match bin_to_dec() and the binary values");
+    sim_check(bin8.minimum == bin8.maximum && bin16.minimum == bin16.maximum, "constant cost for every value");
+
+    return (sim_failures != 0);
+}
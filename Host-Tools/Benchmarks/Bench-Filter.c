@@ -0,0 +1,70 @@
+/*==============================================================================
+ Benchmark: Bench-Filter
+ Date:      October 17, 2026
+
+ Measures the host instructions run by filter_sample() for each filter type,
+ for 1024 noisy 10-bit samples (after the first sample, which fills the
+ filter's history). Host instructions show relative cost, but are not PIC
+ instruction cycles - use the MPLAB X stopwatch for those.
+==============================================================================*/
+
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "ADC-Filter.h"
+
+#define SAMPLES     1024
+
+int main(void)
+{
+    static const struct
+    {
+        const char *name;
+        unsigned char type;
+        unsigned char shift;
+    } filters[] = {
+        {"None", FILTER_NONE, 0},
+        {"Average 4", FILTER_AVERAGE, 2},
+        {"Average 16", FILTER_AVERAGE, 4},
+        {"EMA 1/4", FILTER_EMA, 2},
+        {"EMA 1/64", FILTER_EMA, 6},
+        {"Median 3", FILTER_MEDIAN3, 0},
+        {"Median 5", FILTER_MEDIAN5, 0}
+    };
+    unsigned long instructions;
+    unsigned long total;
+    unsigned long minimum;
+    unsigned long maximum;
+    double average[sizeof(filters) / sizeof(filters[0])];
+
+    printf("Host instructions per filter_sample() call (%d samples)\n", SAMPLES);
+    printf("%-12s %8s %8s %8s\n", "Filter", "Minimum", "Average", "Maximum");
+    for(unsigned char i = 0; i != sizeof(filters) / sizeof(filters[0]); i++)
+    {
+        srand(1);
+        filter_config(0, filters[i].type, filters[i].shift);
+        filter_sample(0, 512);
+        total = maximum = 0;
+        minimum = ~0UL;
+        for(unsigned int n = 0; n != SAMPLES; n++)
+        {
+            unsigned int sample = 512 + (rand() % 64) - 32;
+
+            sim_count_start();
+            filter_sample(0, sample);
+            instructions = sim_count_stop();
+            total += instructions;
+            minimum = (instructions < minimum) ? instructions : minimum;
+            maximum = (instructions > maximum) ? instructions : maximum;
+        }
+        average[i] = (double)total / SAMPLES;
+        printf("%-12s %8lu %8.1f %8lu\n", filters[i].name, minimum, average[i], maximum);
+    }
+    sim_check(average[1] == average[2], "moving average cost doesn't depend on the window size");
+    sim_check(average[3] == average[4], "EMA cost doesn't depend on the weight");
+
+    return (sim_failures != 0);
+}
@@ -0,0 +1,127 @@
+/*==============================================================================
+ Benchmark: Bench-Stream
+ Date:      October 17, 2026
+
+ Measures the bytes sent per sample, and the host instructions run per
+ sample, by packed and compressed sample stream frames for some typical
+ inputs. Bytes include the COBS encoding and frame delimiters. Instructions
+ include building, CRC checking and COBS encoding each frame, and the call
+ to the output function (which only counts the byte). Host instructions
+ show relative cost, but are not PIC instruction cycles - use the MPLAB X
+ stopwatch for those.
+==============================================================================*/
+// CFLAGS: -DSTREAM_WRITE(data)=bench_write(data) -include Benchmarks/Bench.h
+
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <math.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Sample-Stream.h"
+
+#define SAMPLES     2048
+
+static unsigned long bytes;
+
+void bench_write(unsigned char data)
+{
+    (void)data;
+    bytes ++;
+}
+
+// Test inputs
+static unsigned int noise(void)
+{
+    return ((unsigned int)(rand() % 3));    // 0-2 LSB
+}
+
+static unsigned int light(unsigned int n)
+{
+    return ((unsigned int)(512 + 200 * sin(n * 2 * M_PI / 2000)) + noise());
+}
+
+static unsigned int temperature(unsigned int n)
+{
+    (void)n;
+    return (600 + ((rand() % 8 == 0) ? noise() : 1));
+}
+
+static unsigned int constant(unsigned int n)
+{
+    (void)n;
+    return (300);
+}
+
+static unsigned int random_input(unsigned int n)
+{
+    (void)n;
+    return ((unsigned int)rand() & 0x3FF);
+}
+
+// Stream an input and print bytes and host instructions per sample
+static void measure(const char *name, unsigned int (*input)(unsigned int), bool compressed, unsigned long packedBytes, unsigned long *sent)
+{
+    unsigned long instructions = 0;
+    unsigned long worst = 0;
+    unsigned long count;
+
+    srand(1);
+    bytes = 0;
+    if(compressed)
+    {
+        stream_start_compressed(ANQ1);
+    }
+    else
+    {
+        stream_start(ANQ1);
+    }
+    for(unsigned int n = 0; n != SAMPLES; n++)
+    {
+        unsigned int sample = input(n);
+
+        sim_count_start();
+        stream_add_sample(sample);
+        count = sim_count_stop();
+        instructions += count;
+        worst = (count > worst) ? count : worst;
+    }
+    sim_count_start();
+    stream_flush();
+    instructions += sim_count_stop();
+    *sent = bytes;
+    printf("%-12s %-10s %9.3f %9.2f %9.1f %9lu\n", name, (compressed) ? "compressed" : "packed",
+            (double)bytes / SAMPLES, (packedBytes != 0) ? (double)packedBytes / bytes : 1.0,
+            (double)instructions / SAMPLES, worst);
+}
+
+int main(void)
+{
+    static const struct
+    {
+        const char *name;
+        unsigned int (*input)(unsigned int);
+    } inputs[] = {
+        {"Light", light},
+        {"Temperature", temperature},
+        {"Constant", constant},
+        {"Random", random_input}
+    };
+    unsigned long packed;
+    unsigned long compressed;
+
+    printf("%d samples per input. Ratio is packed bytes / bytes sent.\n", SAMPLES);
+    printf("%-12s %-10s %9s %9s %9s %9s\n", "Input", "Frames", "Bytes", "Ratio", "Instr.", "Worst");
+    for(unsigned char i = 0; i != sizeof(inputs) / sizeof(inputs[0]); i++)
+    {
+        measure(inputs[i].name, inputs[i].input, false, 0, &packed);
+        measure(inputs[i].name, inputs[i].input, true, packed, &compressed);
+        if(inputs[i].input != random_input)
+        {
+            sim_check(compressed < packed, "compressed frames are smaller");
+        }
+    }
+    return (sim_failures != 0);
+}
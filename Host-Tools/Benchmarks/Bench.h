@@ -0,0 +1,10 @@
+/*==============================================================================
+ File:  Bench.h
+ Date:  October 17, 2026
+
+ Output function used in place of the firmware's serial output by benchmarks
+ (added to a benchmark's build with -include Benchmarks/Bench.h).
+==============================================================================*/
+
+// Count a byte of output without sending it
+void bench_write(unsigned char);
@@ -0,0 +1,727 @@
+/*==============================================================================
+ Library:   Simulator
+ Date:      October 17, 2026
+
+ PIC16F1459 register file simulator for host builds of the UBMP4 drivers.
+
+ The drivers read and write the simulated registers directly, so the
+ simulator can't see writes as they happen. Instead, each sim_sfr() call
+ first handles the register accessed by the previous call (loading TXREG
+ into the EUSART, flash reads and writes, PORT writes going to LAT), then
+ logs any latch changes at the current cycle, and then runs the peripherals
+ for one instruction cycle. Everything else the peripherals do depends only
+ on register contents, so it is checked every cycle.
+
+ Peripheral models:
+
+ - TMR0: FOSC/4 clock only, with the OPTION_REG prescaler. Stops in Sleep.
+ - TMR1: FOSC/4 or FOSC clock with the T1CON prescaler. Stops in Sleep.
+ - TMR2: T2CON prescaler and postscaler, resets on a match with PR2.
+ - ADC: starts when GO and ADON are set, or on the ADCON2 trigger (TMR0,
+   TMR1 or TMR2), and takes 11.5 TAD using the ADCON1 clock (FRC TAD is
+   1.6us, and only FRC conversions continue in Sleep). Results come from
+   sim_adc_set() or the sim_adc_source() function, justified by ADFM.
+ - EUSART: transmit only, with a TXREG buffer and shift register timed by
+   the baud rate generator. Sent bytes are logged.
+ - INT: edges on RC1 from sim_input() set INTF.
+ - USB: the USTAT FIFO only. Tests act as the SIE, reading and writing the
+   buffer descriptor table themselves.
+ - Program flash: PMCON1 reads, row erases and latched row writes.
+ =============================================================================*/
+
+#include    <signal.h>
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <string.h>
+
+#include    "Simulator.h"
+
+#define SIM_NONE        0xFFFF      // No register accessed yet
+#define SIM_FRC_TAD     19          // FRC TAD (1.6us) in cycles
+#define SIM_ISR_LATENCY 3           // Cycles from a flag to the handler
+#define SIM_FLASH_WRITE 24000       // Cycles the core stalls for a write (2ms)
+
+_Static_assert(SIM_TMR1H == SIM_TMR1L + 1, "TMR1L and TMR1H must be together");
+
+// Register file. TMR1L and TMR1H are read as one 16-bit TMR1 register.
+static union
+{
+    unsigned char bytes[SIM_REGISTERS];
+    uint16_t words[(SIM_REGISTERS + 1) / 2];
+} simFile;
+#define R(reg)          (simFile.bytes[reg])
+
+// Simulator state
+unsigned long sim_cycle;
+unsigned long sim_cycle_limit = 500000000;  // Stop runaway programs
+sim_pin_change_t sim_pin_log[SIM_PIN_LOG_SIZE];
+unsigned long sim_pin_changes;
+unsigned char sim_tx_log[SIM_TX_LOG_SIZE];
+unsigned int sim_tx_bytes;
+unsigned int sim_flash[0x2000];
+unsigned long sim_conversions;
+unsigned long sim_interrupts;
+unsigned long sim_sleeps;
+unsigned long sim_resets;
+
+static void (*simIsr)(void);
+static void (*simStimulus)(void);
+static bool simInIsr;
+static bool simSleeping;
+static unsigned int simLast = SIM_NONE;     // Register accessed last
+static unsigned char simLastValue;          // Its value when accessed
+static unsigned char simLatches[3];         // Latch values already logged
+static unsigned char simInputs[3] = {0xFF, 0xFF, 0xFF};
+
+static unsigned int simTmr0Count;           // Prescaler counts
+static unsigned int simTmr1Count;
+static unsigned int simTmr2Count;
+static unsigned char simTmr2Post;           // Postscaler count
+
+static bool simAdcBusy;
+static unsigned long simAdcLeft;            // Cycles until the result
+static bool simAdcFrc;
+static unsigned int simAdcValues[32];
+static unsigned int (*simAdcSource)(unsigned char);
+
+static bool simTxFull;                      // TXREG holds a byte
+static bool simTxBusy;                      // Shift register is sending
+static unsigned char simTxShift;
+static unsigned long simTxLeft;
+
+static unsigned char simUstat[4];           // USTAT FIFO
+static unsigned char simUstatCount;
+
+static unsigned int simFlashLatch[32];
+
+// Set every register to its power-on value
+void sim_reset(void)
+{
+    memset(&simFile, 0, sizeof(simFile));
+    R(SIM_OSCCON) = 0x3C;
+    R(SIM_OSCSTAT) = 0x40;      // PLL always ready
+    R(SIM_OPTION_REG) = 0xFF;
+    R(SIM_TRISA) = 0xFF;
+    R(SIM_TRISB) = 0xFF;
+    R(SIM_TRISC) = 0xFF;
+    R(SIM_ANSELA) = 0x10;
+    R(SIM_ANSELB) = 0x30;
+    R(SIM_ANSELC) = 0xCF;
+    R(SIM_WPUA) = 0x3F;
+    R(SIM_WPUB) = 0xF0;
+    R(SIM_PR2) = 0xFF;
+    R(SIM_TXSTA) = 0x02;
+    R(SIM_PMCON1) = 0x80;
+
+    sim_cycle = 0;
+    sim_pin_changes = 0;
+    sim_tx_bytes = 0;
+    sim_conversions = 0;
+    sim_interrupts = 0;
+    sim_sleeps = 0;
+    sim_resets = 0;
+    for(unsigned int i = 0; i != 0x2000; i++)
+    {
+        sim_flash[i] = 0x3FFF;
+    }
+    for(unsigned int i = 0; i != 32; i++)
+    {
+        simAdcValues[i] = 0;
+        simFlashLatch[i] = 0x3FFF;
+    }
+    simIsr = NULL;
+    simStimulus = NULL;
+    simInIsr = false;
+    simSleeping = false;
+    simLast = SIM_NONE;
+    memset(simLatches, 0, sizeof(simLatches));
+    memset(simInputs, 0xFF, sizeof(simInputs));
+    simTmr0Count = simTmr1Count = simTmr2Count = 0;
+    simTmr2Post = 0;
+    simAdcBusy = false;
+    simAdcSource = NULL;
+    simTxFull = simTxBusy = false;
+    simUstatCount = 0;
+}
+
+void sim_set_isr(void (*isr)(void))
+{
+    simIsr = isr;
+}
+
+void sim_set_stimulus(void (*stimulus)(void))
+{
+    simStimulus = stimulus;
+}
+
+void sim_adc_set(unsigned char channel, unsigned int value)
+{
+    simAdcValues[channel & 31] = value & 0x3FF;
+}
+
+void sim_adc_source(unsigned int (*source)(unsigned char))
+{
+    simAdcSource = source;
+}
+
+// Port register index and latch for 'A', 'B' or 'C'
+static unsigned int sim_port_index(unsigned char port)
+{
+    return ((port == 'A') ? 0 : (port == 'B') ? 1 : 2);
+}
+
+// Work out the value read from a port: latch bits for outputs, pin levels
+// for digital inputs, and 0 for analog inputs
+static unsigned char sim_port_value(unsigned int index)
+{
+    unsigned char tris = R(SIM_TRISA + index);
+
+    return ((R(SIM_LATA + index) & ~tris) | (simInputs[index] & tris & ~R(SIM_ANSELA + index)));
+}
+
+void sim_input(unsigned char port, unsigned char bit, bool level)
+{
+    unsigned int index = sim_port_index(port);
+    unsigned char before = simInputs[index];
+
+    if(level)
+    {
+        simInputs[index] |= (1 << bit);
+    }
+    else
+    {
+        simInputs[index] &= ~(1 << bit);
+    }
+
+    // INT is on RC1. INTEDG set is the rising edge.
+    if(index == 2 && bit == 1 && ((before >> 1) & 1) != level)
+    {
+        if(level == ((R(SIM_OPTION_REG) >> 6) & 1))
+        {
+            R(SIM_INTCON) |= 0b00000010;
+        }
+    }
+}
+
+void sim_usb_transaction(unsigned char ustat)
+{
+    if(simUstatCount != sizeof(simUstat))
+    {
+        simUstat[simUstatCount++] = ustat;
+    }
+}
+
+// Log latch changes made since the last check
+static void sim_check_pins(void)
+{
+    for(unsigned int index = 0; index != 3; index++)
+    {
+        if(R(SIM_LATA + index) != simLatches[index])
+        {
+            simLatches[index] = R(SIM_LATA + index);
+            if(sim_pin_changes < SIM_PIN_LOG_SIZE)
+            {
+                sim_pin_log[sim_pin_changes].cycle = sim_cycle;
+                sim_pin_log[sim_pin_changes].port = 'A' + index;
+                sim_pin_log[sim_pin_changes].value = simLatches[index];
+            }
+            sim_pin_changes ++;
+        }
+    }
+}
+
+// Start an ADC conversion
+static void sim_adc_start(void)
+{
+    static const unsigned char tad[8] = {1, 4, 16, 0, 2, 8, 32, 0}; // Half cycles
+    unsigned char adcs = (R(SIM_ADCON1) >> 4) & 7;
+
+    simAdcBusy = true;
+    simAdcFrc = (tad[adcs] == 0);
+    simAdcLeft = (simAdcFrc) ? (23 * SIM_FRC_TAD + 1) / 2 + 1 : (23 * tad[adcs] + 3) / 4;
+    R(SIM_ADCON0) |= 0b00000010;    // GO stays set until the result is ready
+}
+
+// Finish an ADC conversion
+static void sim_adc_finish(void)
+{
+    unsigned char channel = (R(SIM_ADCON0) >> 2) & 31;
+    unsigned int value = (simAdcSource != NULL) ? simAdcSource(channel) : simAdcValues[channel];
+
+    value &= 0x3FF;
+    if(R(SIM_ADCON1) & 0b10000000)  // Right justified
+    {
+        R(SIM_ADRESH) = (unsigned char)(value >> 8);
+        R(SIM_ADRESL) = (unsigned char)value;
+    }
+    else
+    {
+        R(SIM_ADRESH) = (unsigned char)(value >> 2);
+        R(SIM_ADRESL) = (unsigned char)(value << 6);
+    }
+    simAdcBusy = false;
+    R(SIM_ADCON0) &= ~0b00000010;
+    R(SIM_PIR1) |= 0b01000000;      // ADIF
+    sim_conversions ++;
+}
+
+// ADC auto-conversion trigger
+static void sim_adc_trigger(unsigned char source)
+{
+    if((R(SIM_ADCON2) >> 4) == source && (R(SIM_ADCON0) & 1) && !simAdcBusy)
+    {
+        sim_adc_start();
+    }
+}
+
+// Run the peripherals for one instruction cycle
+static void sim_tick(void)
+{
+    sim_cycle ++;
+    if(sim_cycle > sim_cycle_limit)
+    {
+        fprintf(stderr, "Simulator: cycle limit reached (program stuck?)\n");
+        exit(2);
+    }
+    if(simStimulus != NULL)
+    {
+        simStimulus();
+    }
+
+    if(!simSleeping)
+    {
+        // TMR0
+        unsigned char option = R(SIM_OPTION_REG);
+
+        if((option & 0b00100000) == 0)
+        {
+            simTmr0Count ++;
+            if((option & 0b00001000) || simTmr0Count >= (2u << (option & 7)))
+            {
+                simTmr0Count = 0;
+                R(SIM_TMR0) ++;
+                if(R(SIM_TMR0) == 0)
+                {
+                    R(SIM_INTCON) |= 0b00000100;    // TMR0IF
+                    sim_adc_trigger(3);
+                }
+            }
+        }
+
+        // TMR1
+        unsigned char t1con = R(SIM_T1CON);
+
+        if(t1con & 1)
+        {
+            unsigned int counts = ((t1con >> 6) == 1) ? 4 : 1;     // FOSC or FOSC/4
+
+            simTmr1Count += counts;
+            while(simTmr1Count >= (1u << ((t1con >> 4) & 3)))
+            {
+                simTmr1Count -= (1u << ((t1con >> 4) & 3));
+                simFile.words[SIM_TMR1L / 2] ++;
+                if(simFile.words[SIM_TMR1L / 2] == 0)
+                {
+                    R(SIM_PIR1) |= 0b00000001;      // TMR1IF
+                    sim_adc_trigger(4);
+                }
+            }
+        }
+
+        // TMR2
+        unsigned char t2con = R(SIM_T2CON);
+
+        if(t2con & 0b00000100)
+        {
+            simTmr2Count ++;
+            if(simTmr2Count >= (1u << ((t2con & 3) * 2)))
+            {
+                simTmr2Count = 0;
+                if(R(SIM_TMR2) == R(SIM_PR2))
+                {
+                    R(SIM_TMR2) = 0;
+                    sim_adc_trigger(5);
+                    simTmr2Post ++;
+                    if(simTmr2Post > ((t2con >> 3) & 15))
+                    {
+                        simTmr2Post = 0;
+                        R(SIM_PIR1) |= 0b00000010;  // TMR2IF
+                    }
+                }
+                else
+                {
+                    R(SIM_TMR2) ++;
+                }
+            }
+        }
+
+        // EUSART transmitter
+        if((R(SIM_RCSTA) & 0b10000000) && (R(SIM_TXSTA) & 0b00100000))
+        {
+            if(!simTxBusy && simTxFull)
+            {
+                bool brg16 = R(SIM_BAUDCON) & 0b00001000;
+                bool brgh = R(SIM_TXSTA) & 0b00000100;
+                unsigned long n = (brg16) ? ((unsigned int)R(SIM_SPBRGH) << 8) | R(SIM_SPBRGL) : R(SIM_SPBRGL);
+                unsigned long divisor = (brg16 && brgh) ? 4 : (brg16 || brgh) ? 16 : 64;
+
+                simTxShift = R(SIM_TXREG);
+                simTxFull = false;
+                simTxBusy = true;
+                simTxLeft = 10 * (divisor * (n + 1) / 4);
+            }
+            else if(simTxBusy && --simTxLeft == 0)
+            {
+                if(sim_tx_bytes < SIM_TX_LOG_SIZE)
+                {
+                    sim_tx_log[sim_tx_bytes] = simTxShift;
+                }
+                sim_tx_bytes ++;
+                simTxBusy = false;
+            }
+        }
+        R(SIM_PIR1) = (R(SIM_PIR1) & ~0b00010000) | ((simTxFull) ? 0 : 0b00010000);
+        R(SIM_TXSTA) = (R(SIM_TXSTA) & ~0b00000010) | ((simTxBusy) ? 0 : 0b00000010);
+    }
+
+    // ADC. Only FRC conversions continue in Sleep.
+    if(simAdcBusy && (!(R(SIM_ADCON0) & 1) || !(R(SIM_ADCON0) & 0b00000010)))
+    {
+        simAdcBusy = false;     // ADC turned off or GO cleared: abandoned
+    }
+    if(!simAdcBusy && (R(SIM_ADCON0) & 0b00000011) == 0b00000011)
+    {
+        sim_adc_start();
+    }
+    if(simAdcBusy && (!simSleeping || simAdcFrc))
+    {
+        if(--simAdcLeft == 0)
+        {
+            sim_adc_finish();
+        }
+    }
+
+    // USB USTAT FIFO
+    if(simUstatCount != 0 && !(R(SIM_UIR) & 0b00001000))
+    {
+        R(SIM_USTAT) = simUstat[0];
+        memmove(simUstat, simUstat + 1, --simUstatCount);
+        R(SIM_UIR) |= 0b00001000;   // TRNIF
+        R(SIM_PIR2) |= 0b00000100;  // USBIF
+    }
+}
+
+// True if an enabled interrupt is flagged (ignoring GIE)
+static bool sim_interrupt_flagged(void)
+{
+    unsigned char intcon = R(SIM_INTCON);
+
+    if((intcon & (intcon >> 3)) & 0b00000111)   // TMR0, INT and IOC
+    {
+        return (true);
+    }
+    return ((intcon & 0b01000000) && ((R(SIM_PIE1) & R(SIM_PIR1)) || (R(SIM_PIE2) & R(SIM_PIR2))));
+}
+
+// Handle the register accessed by the previous sim_sfr() call
+static void sim_written(void)
+{
+    unsigned int reg = simLast;
+
+    simLast = SIM_NONE;
+    if(reg == SIM_NONE)
+    {
+        return;
+    }
+    if(reg == SIM_PORTA || reg == SIM_PORTB || reg == SIM_PORTC)
+    {
+        if(R(reg) != simLastValue)
+        {
+            R(SIM_LATA + reg - SIM_PORTA) = R(reg);     // Port writes go to LAT
+        }
+    }
+    else if(reg == SIM_TXREG)
+    {
+        simTxFull = true;       // TXREG is never read
+        R(SIM_PIR1) &= ~0b00010000;
+    }
+    else if(reg == SIM_TMR0 && R(reg) != simLastValue)
+    {
+        simTmr0Count = 0;       // Writing TMR0 clears the prescaler
+    }
+    else if(reg == SIM_TMR2 || reg == SIM_T2CON)
+    {
+        simTmr2Count = 0;       // Writing TMR2 or T2CON clears the prescaler
+        if(reg == SIM_T2CON)
+        {
+            simTmr2Post = 0;
+        }
+    }
+    else if(reg == SIM_PMCON1)
+    {
+        unsigned int address = (((unsigned int)R(SIM_PMADRH) << 8) | R(SIM_PMADRL)) & 0x1FFF;
+        unsigned int data = (((unsigned int)R(SIM_PMDATH) << 8) | R(SIM_PMDATL)) & 0x3FFF;
+
+        if(R(SIM_PMCON1) & 0b00000001)  // RD
+        {
+            R(SIM_PMDATL) = (unsigned char)sim_flash[address];
+            R(SIM_PMDATH) = (unsigned char)(sim_flash[address] >> 8);
+            R(SIM_PMCON1) &= ~0b00000001;
+        }
+        if((R(SIM_PMCON1) & 0b00000110) == 0b00000110)  // WREN and WR
+        {
+            if(R(SIM_PMCON1) & 0b00010000)  // FREE: erase the row
+            {
+                for(unsigned int i = 0; i != 32; i++)
+                {
+                    sim_flash[(address & ~31u) + i] = 0x3FFF;
+                }
+            }
+            else
+            {
+                simFlashLatch[address & 31] = data;
+                if(!(R(SIM_PMCON1) & 0b00100000))   // LWLO clear: write the row
+                {
+                    for(unsigned int i = 0; i != 32; i++)
+                    {
+                        sim_flash[(address & ~31u) + i] &= simFlashLatch[i];
+                        simFlashLatch[i] = 0x3FFF;
+                    }
+                }
+            }
+            R(SIM_PMCON1) &= ~0b00000010;
+            if(!(R(SIM_PMCON1) & 0b00100000) || (R(SIM_PMCON1) & 0b00010000))
+            {
+                for(unsigned long i = 0; i != SIM_FLASH_WRITE; i++)
+                {
+                    sim_tick();     // Core stalls while flash is written
+                }
+            }
+        }
+    }
+}
+
+// Call the interrupt handler if an enabled interrupt is flagged
+static void sim_dispatch(void)
+{
+    if(simInIsr || simIsr == NULL || !(R(SIM_INTCON) & 0b10000000) || !sim_interrupt_flagged())
+    {
+        return;
+    }
+    simInIsr = true;
+    R(SIM_INTCON) &= ~0b10000000;   // Hardware clears GIE
+    for(unsigned int i = 0; i != SIM_ISR_LATENCY; i++)
+    {
+        sim_tick();
+    }
+    sim_interrupts ++;
+    simIsr();
+    sim_written();              // The handler's last register access
+    sim_check_pins();
+    R(SIM_INTCON) |= 0b10000000;    // RETFIE sets GIE
+    simInIsr = false;
+}
+
+// One instruction cycle of program execution
+static void sim_step(void)
+{
+    sim_written();
+    sim_check_pins();
+    sim_tick();
+    sim_dispatch();
+}
+
+volatile unsigned char *sim_sfr(unsigned int reg)
+{
+    sim_step();
+    if(reg == SIM_PORTA || reg == SIM_PORTB || reg == SIM_PORTC)
+    {
+        R(reg) = sim_port_value(reg - SIM_PORTA);
+    }
+    simLast = reg;
+    simLastValue = R(reg);
+    return (&R(reg));
+}
+
+// 16-bit TMR1 access, counted as 4 cycles (a 16-bit read-modify-write)
+volatile uint16_t *sim_sfr16(unsigned int reg)
+{
+    for(unsigned int i = 0; i != 4; i++)
+    {
+        sim_step();
+    }
+    simLast = reg;
+    simLastValue = R(reg);
+    return (&simFile.words[reg / 2]);
+}
+
+void sim_delay(unsigned long cycles)
+{
+    while(cycles != 0)
+    {
+        sim_step();
+        cycles --;
+    }
+}
+
+void sim_run(unsigned long cycles)
+{
+    sim_delay(cycles);
+}
+
+// Sleep until an enabled interrupt is flagged. Only the ADC (with its FRC
+// clock), INT and USB keep working.
+void sim_sleep(void)
+{
+    sim_sleeps ++;
+    sim_written();
+    sim_check_pins();
+    if(sim_interrupt_flagged())
+    {
+        sim_tick();             // Flagged already: SLEEP runs as a NOP
+        return;
+    }
+    simSleeping = true;
+    while(!sim_interrupt_flagged())
+    {
+        sim_tick();
+    }
+    simSleeping = false;
+    sim_tick();
+    sim_dispatch();
+}
+
+void sim_reset_instruction(void)
+{
+    sim_resets ++;
+}
+
+// Pin level at a cycle, from the pin log (pins start low after sim_reset())
+static bool sim_pin_level(unsigned char port, unsigned char bit, unsigned long cycle)
+{
+    bool level = false;
+    unsigned long changes = (sim_pin_changes < SIM_PIN_LOG_SIZE) ? sim_pin_changes : SIM_PIN_LOG_SIZE;
+
+    for(unsigned long i = 0; i != changes && sim_pin_log[i].cycle <= cycle; i++)
+    {
+        if(sim_pin_log[i].port == port)
+        {
+            level = (sim_pin_log[i].value >> bit) & 1;
+        }
+    }
+    return (level);
+}
+
+unsigned int sim_serial_decode(unsigned char port, unsigned char bit, double bitCycles,
+        unsigned long from, unsigned char *data, unsigned int max, double *edgeError)
+{
+    unsigned long changes = (sim_pin_changes < SIM_PIN_LOG_SIZE) ? sim_pin_changes : SIM_PIN_LOG_SIZE;
+    unsigned int bytes = 0;
+    bool level = sim_pin_level(port, bit, from);
+    unsigned long start;
+
+    *edgeError = 0;
+    for(unsigned long i = 0; i != changes && bytes != max; i++)
+    {
+        bool next = (sim_pin_log[i].value >> bit) & 1;
+
+        if(sim_pin_log[i].port != port || sim_pin_log[i].cycle < from || next == level)
+        {
+            continue;
+        }
+        level = next;
+        if(level)
+        {
+            continue;           // Looking for a start bit
+        }
+
+        // Start bit: read the data and stop bits, and time the frame's edges
+        start = sim_pin_log[i].cycle;
+        data[bytes] = 0;
+        for(unsigned int n = 1; n != 9; n++)
+        {
+            data[bytes] |= sim_pin_level(port, bit, start + (unsigned long)((n + 0.5) * bitCycles)) << (n - 1);
+        }
+        if(!sim_pin_level(port, bit, start + (unsigned long)(9.5 * bitCycles)))
+        {
+            break;              // Framing error
+        }
+        while(i + 1 != changes && sim_pin_log[i + 1].cycle < start + (unsigned long)(9.5 * bitCycles))
+        {
+            i ++;
+            next = (sim_pin_log[i].value >> bit) & 1;
+            if(sim_pin_log[i].port == port && next != level)
+            {
+                double bits = (sim_pin_log[i].cycle - start) / bitCycles;
+                double error = bits - (unsigned long)(bits + 0.5);
+
+                error = (error < 0) ? -error : error;
+                *edgeError = (error > *edgeError) ? error : *edgeError;
+                level = next;
+            }
+        }
+        bytes ++;
+    }
+    return (bytes);
+}
+
+unsigned int sim_failures;
+
+bool sim_check(bool pass, const char *what)
+{
+    printf("%s: %s\n", (pass) ? "PASS" : "FAIL", what);
+    if(!pass)
+    {
+        sim_failures ++;
+    }
+    return (pass);
+}
+
+// Host instruction counter. Setting the x86 trap flag raises SIGTRAP after
+// every instruction. The kernel clears the flag while the handler runs and
+// restores it when the handler returns.
+static volatile unsigned long simSteps;
+static unsigned long simStepOverhead;
+
+static void sim_step_trap(int signal)
+{
+    (void)signal;
+    simSteps ++;
+}
+
+__attribute__((noinline)) static void sim_trap_on(void)
+{
+    __asm__ volatile("pushfq; orq $0x100, (%%rsp); popfq" ::: "memory", "cc");
+}
+
+__attribute__((noinline)) static void sim_trap_off(void)
+{
+    __asm__ volatile("pushfq; andq $~0x100, (%%rsp); popfq" ::: "memory", "cc");
+}
+
+void sim_count_start(void)
+{
+    static bool ready;
+
+    if(!ready)
+    {
+        struct sigaction action;
+
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = sim_step_trap;
+        sigaction(SIGTRAP, &action, NULL);
+        ready = true;
+        simSteps = 0;
+        sim_trap_on();
+        sim_trap_off();
+        simStepOverhead = simSteps;     // Steps counted for an empty interval
+    }
+    simSteps = 0;
+    sim_trap_on();
+}
+
+unsigned long sim_count_stop(void)
+{
+    sim_trap_off();
+    return (simSteps - simStepOverhead);
+}
@@ -0,0 +1,204 @@
+/*==============================================================================
+ File:  Simulator.h
+ Date:  October 17, 2026
+
+ PIC16F1459 register file simulator function prototypes
+
+ Function prototypes for the host simulator used to build and test the UBMP4
+ drivers on Linux. The drivers access SFRs through the definitions in the
+ simulator's xc.h, which call sim_sfr(). Each call runs the simulated
+ peripherals (TMR0, TMR1, TMR2, ADC, EUSART, INT pin, USB transaction FIFO,
+ program flash) for one instruction cycle, dispatches the interrupt handler
+ set by sim_set_isr() if an enabled interrupt is flagged, and returns the
+ register's address.
+
+ The virtual cycle clock counts instruction cycles (FOSC/4, 83.3ns at 48
+ MHz). It advances by one cycle for each SFR access and by the full length
+ of each __delay_us(), __delay_ms() and _delay(), so delay-timed code (bit-
+ banged serial, acquisition waits) and peripheral-timed code (interrupts,
+ conversions) are timed like the device. Code that only uses RAM takes no
+ virtual time. Its cost can be counted in host instructions instead (see
+ sim_count_start()).
+==============================================================================*/
+
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include    <stdint.h>
+#include    <stdbool.h>
+
+// Simulated registers
+enum
+{
+    SIM_OSCCON, SIM_OSCSTAT, SIM_ACTCON, SIM_OPTION_REG, SIM_INTCON,
+    SIM_PIR1, SIM_PIR2, SIM_PIE1, SIM_PIE2,
+    SIM_PORTA, SIM_PORTB, SIM_PORTC, SIM_LATA, SIM_LATB, SIM_LATC,
+    SIM_TRISA, SIM_TRISB, SIM_TRISC, SIM_ANSELA, SIM_ANSELB, SIM_ANSELC,
+    SIM_WPUA, SIM_WPUB, SIM_FVRCON,
+    SIM_ADCON0, SIM_ADCON1, SIM_ADCON2, SIM_ADRESH, SIM_ADRESL,
+    SIM_TMR0, SIM_TMR1L, SIM_TMR1H, SIM_T1CON, SIM_T1GCON,
+    SIM_TMR2, SIM_PR2, SIM_T2CON,
+    SIM_PWM1CON, SIM_PWM1DCH, SIM_PWM1DCL, SIM_PWM2CON, SIM_PWM2DCH, SIM_PWM2DCL,
+    SIM_TXREG, SIM_TXSTA, SIM_RCSTA, SIM_BAUDCON, SIM_SPBRGL, SIM_SPBRGH,
+    SIM_PMADRL, SIM_PMADRH, SIM_PMDATL, SIM_PMDATH, SIM_PMCON1, SIM_PMCON2,
+    SIM_UCON, SIM_UCFG, SIM_USTAT, SIM_UIR, SIM_UIE, SIM_UADDR,
+    SIM_UEP0, SIM_UEP1, SIM_UEP2,
+    SIM_REGISTERS
+};
+
+// Pin activity log entry, added each time a port latch changes
+typedef struct
+{
+    unsigned long cycle;        // Virtual cycle of the change
+    unsigned char port;         // 'A', 'B' or 'C'
+    unsigned char value;        // New latch value
+} sim_pin_change_t;
+
+#define SIM_PIN_LOG_SIZE    65536
+#define SIM_TX_LOG_SIZE     4096
+
+// Virtual cycle clock
+extern unsigned long sim_cycle;
+
+// The simulator exits (status 2) if the cycle clock passes this limit, to stop
+// programs stuck waiting for something the simulator doesn't model
+extern unsigned long sim_cycle_limit;
+
+// Pin activity log
+extern sim_pin_change_t sim_pin_log[SIM_PIN_LOG_SIZE];
+extern unsigned long sim_pin_changes;
+
+// Bytes sent by the EUSART
+extern unsigned char sim_tx_log[SIM_TX_LOG_SIZE];
+extern unsigned int sim_tx_bytes;
+
+// Program flash (14-bit words) used by PMCON reads and writes
+extern unsigned int sim_flash[0x2000];
+
+// Event counts
+extern unsigned long sim_conversions;   // ADC conversions completed
+extern unsigned long sim_interrupts;    // Interrupt handler calls
+extern unsigned long sim_sleeps;        // SLEEP() instructions
+extern unsigned long sim_resets;        // RESET() instructions
+
+/**
+ * Function: void sim_reset(void)
+ *
+ * Set every register to its power-on value, clear the cycle clock, logs and
+ * counts, and remove the interrupt handler, stimulus and ADC source.
+ */
+void sim_reset(void);
+
+/**
+ * Function: void sim_set_isr(void (*isr)(void))
+ *
+ * Set the function called when an enabled interrupt is flagged and GIE is
+ * set. GIE is cleared while it runs, as on the device.
+ */
+void sim_set_isr(void (*)(void));
+
+/**
+ * Function: void sim_run(unsigned long cycles)
+ *
+ * Advance the cycle clock, running peripherals and interrupts, as if the
+ * program were waiting in a loop that doesn't use any SFRs.
+ */
+void sim_run(unsigned long);
+
+/**
+ * Function: void sim_adc_set(unsigned char channel, unsigned int value)
+ *
+ * Set the 10-bit result of conversions of an ADC channel (CHS number, e.g.
+ * ANQ1 >> 2).
+ */
+void sim_adc_set(unsigned char, unsigned int);
+
+/**
+ * Function: void sim_adc_source(unsigned int (*source)(unsigned char channel))
+ *
+ * Set a function to give the 10-bit result of each conversion instead of the
+ * values set by sim_adc_set(), or NULL to go back to them.
+ */
+void sim_adc_source(unsigned int (*)(unsigned char));
+
+/**
+ * Function: void sim_input(unsigned char port, unsigned char bit, bool level)
+ *
+ * Drive a pin ('A', 'B' or 'C' port, bit 0-7) set as an input. A falling
+ * (or rising, set by INTEDG) edge on RC1 sets INTF.
+ */
+void sim_input(unsigned char, unsigned char, bool);
+
+/**
+ * Function: void sim_set_stimulus(void (*stimulus)(void))
+ *
+ * Set a function called at the start of every instruction cycle, before the
+ * peripherals run, or NULL for none. It can drive inputs with sim_input() at
+ * exact cycles (see sim_cycle), such as a serial waveform on H2.
+ */
+void sim_set_stimulus(void (*)(void));
+
+/**
+ * Function: void sim_usb_transaction(unsigned char ustat)
+ *
+ * Queue a completed USB transaction in the USTAT FIFO (up to 4), as the SIE
+ * does. The first queued USTAT value is loaded and TRNIF and USBIF are set;
+ * each time the program clears TRNIF the next one is loaded.
+ */
+void sim_usb_transaction(unsigned char);
+
+/**
+ * Function: unsigned int sim_serial_decode(unsigned char port, unsigned char bit,
+ *               double bitCycles, unsigned long from, unsigned char *data,
+ *               unsigned int max, double *edgeError)
+ *
+ * Decode 8,N,1 serial frames sent on an output pin, using the pin log from
+ * the cycle 'from' on. Each frame is timed from its start bit's falling edge
+ * and its bits are read in the middle of each bit period. Decoding stops at
+ * a frame without a stop bit, or after max bytes. Returns the number of
+ * bytes stored in data, and sets edgeError to the largest difference of any
+ * edge within a frame from its ideal time, as a fraction of a bit period.
+ */
+unsigned int sim_serial_decode(unsigned char, unsigned char, double, unsigned long,
+        unsigned char *, unsigned int, double *);
+
+/**
+ * Function: void sim_count_start(void)
+ *
+ * Start counting the host instructions run, by single-stepping with the x86
+ * trap flag (about 4us per instruction). Counts include the simulator's own
+ * instructions for any SFR accesses, so use it for code that only uses RAM.
+ */
+void sim_count_start(void);
+
+/**
+ * Function: unsigned long sim_count_stop(void)
+ *
+ * Stop counting and return the number of host instructions run since
+ * sim_count_start(), not including the counting functions themselves.
+ *
+ * Example usage: sim_count_start(); bin8_to_ascii(value, digits);
+ *                instructions = sim_count_stop();
+ */
+unsigned long sim_count_stop(void);
+
+/**
+ * Function: bool sim_check(bool pass, const char *what)
+ *
+ * Test helper. Print what, with PASS or FAIL, count failures in
+ * sim_failures, and return pass.
+ *
+ * Example usage: sim_check(sample == 0x3FF, "full scale sample");
+ */
+bool sim_check(bool, const char *);
+
+extern unsigned int sim_failures;
+
+// Called through the definitions in xc.h
+volatile unsigned char *sim_sfr(unsigned int);
+volatile uint16_t *sim_sfr16(unsigned int);
+void sim_delay(unsigned long);
+void sim_sleep(void);
+void sim_reset_instruction(void);
+
+#endif
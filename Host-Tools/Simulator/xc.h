@@ -0,0 +1,210 @@
+/*==============================================================================
+ File:  xc.h (host simulator)
+ Date:  October 17, 2026
+
+ Host replacement for the Microchip XC8 xc.h file
+
+ Lets the UBMP4 driver files be compiled and run on Linux by a normal C
+ compiler. Every PIC16F1459 special function register (SFR) and SFR bit used
+ by the drivers is defined here as an access through sim_sfr(), which runs
+ the simulated peripherals for one instruction cycle before returning the
+ register's address in the simulated register file (see Simulator.h). The
+ XC8 delay macros, SLEEP(), NOP() and RESET() advance the same virtual
+ cycle clock.
+
+ Only the registers and bits used by the drivers are defined, with the bit
+ positions of the PIC16F1459 data sheet. Add new ones to the register list
+ in Simulator.h and here as they are needed.
+==============================================================================*/
+
+#ifndef SIM_XC_H
+#define SIM_XC_H
+
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "Simulator.h"
+
+// XC8 keywords and built-in functions
+#define __interrupt(...)
+#define __at(address)
+#define __section(name)
+#define __delay_us(us)  sim_delay((unsigned long)((us) * (_XTAL_FREQ / 4000000UL)))
+#define __delay_ms(ms)  sim_delay((unsigned long)((ms) * (_XTAL_FREQ / 4000UL)))
+#define _delay(cycles)  sim_delay((unsigned long)(cycles))
+#define NOP()           sim_delay(1)
+#define SLEEP()         sim_sleep()
+#define RESET()         sim_reset_instruction()
+#define CLRWDT()        sim_delay(1)
+#define di()            (GIE = 0)
+#define ei()            (GIE = 1)
+
+// Register access
+#define SIM_REG(reg)            (*sim_sfr(reg))
+#define SIM_BITS(type, reg)     (*(volatile type *)sim_sfr(reg))
+
+// Bit field types, one for each register that has bits used by the drivers
+typedef struct { unsigned char RA0:1, RA1:1, RA2:1, RA3:1, RA4:1, RA5:1, :2; } sim_porta_t;
+typedef struct { unsigned char LATA0:1, LATA1:1, LATA2:1, LATA3:1, LATA4:1, LATA5:1, :2; } sim_lata_t;
+typedef struct { unsigned char TRISA0:1, TRISA1:1, TRISA2:1, TRISA3:1, TRISA4:1, TRISA5:1, :2; } sim_trisa_t;
+typedef struct { unsigned char :4, RB4:1, RB5:1, RB6:1, RB7:1; } sim_portb_t;
+typedef struct { unsigned char :4, LATB4:1, LATB5:1, LATB6:1, LATB7:1; } sim_latb_t;
+typedef struct { unsigned char :4, TRISB4:1, TRISB5:1, TRISB6:1, TRISB7:1; } sim_trisb_t;
+typedef struct { unsigned char RC0:1, RC1:1, RC2:1, RC3:1, RC4:1, RC5:1, RC6:1, RC7:1; } sim_portc_t;
+typedef struct { unsigned char LATC0:1, LATC1:1, LATC2:1, LATC3:1, LATC4:1, LATC5:1, LATC6:1, LATC7:1; } sim_latc_t;
+typedef struct { unsigned char TRISC0:1, TRISC1:1, TRISC2:1, TRISC3:1, TRISC4:1, TRISC5:1, TRISC6:1, TRISC7:1; } sim_trisc_t;
+typedef struct { unsigned char ANSC0:1, ANSC1:1, ANSC2:1, ANSC3:1, :2, ANSC6:1, ANSC7:1; } sim_anselc_t;
+typedef struct { unsigned char IOCIF:1, INTF:1, TMR0IF:1, IOCIE:1, INTE:1, TMR0IE:1, PEIE:1, GIE:1; } sim_intcon_t;
+typedef struct { unsigned char PS:3, PSA:1, TMR0SE:1, TMR0CS:1, INTEDG:1, nWPUEN:1; } sim_option_t;
+typedef struct { unsigned char TMR1IF:1, TMR2IF:1, :1, SSP1IF:1, TXIF:1, RCIF:1, ADIF:1, TMR1GIF:1; } sim_pir1_t;
+typedef struct { unsigned char TMR1IE:1, TMR2IE:1, :1, SSP1IE:1, TXIE:1, RCIE:1, ADIE:1, TMR1GIE:1; } sim_pie1_t;
+typedef struct { unsigned char :1, ACTIF:1, USBIF:1, BCL1IF:1, :1, C1IF:1, C2IF:1, OSFIF:1; } sim_pir2_t;
+typedef struct { unsigned char :1, ACTIE:1, USBIE:1, BCL1IE:1, :1, C1IE:1, C2IE:1, OSFIE:1; } sim_pie2_t;
+typedef struct { unsigned char ADON:1, GO:1, CHS:5, :1; } sim_adcon0_t;
+typedef struct { unsigned char ADPREF:2, :2, ADCS:3, ADFM:1; } sim_adcon1_t;
+typedef struct { unsigned char TMR1ON:1, :1, nT1SYNC:1, T1OSCEN:1, T1CKPS:2, TMR1CS:2; } sim_t1con_t;
+typedef struct { unsigned char T2CKPS:2, TMR2ON:1, T2OUTPS:4, :1; } sim_t2con_t;
+typedef struct { unsigned char HFIOFS:1, LFIOFR:1, :1, HFIOFR:1, :2, PLLRDY:1, SOSCR:1; } sim_oscstat_t;
+typedef struct { unsigned char TX9D:1, TRMT:1, BRGH:1, SENDB:1, SYNC:1, TXEN:1, TX9:1, CSRC:1; } sim_txsta_t;
+typedef struct { unsigned char RD:1, WR:1, WREN:1, WRERR:1, FREE:1, LWLO:1, CFGS:1, :1; } sim_pmcon1_t;
+typedef struct { unsigned char :1, SUSPND:1, RESUME:1, USBEN:1, PKTDIS:1, SE0:1, PPBRST:1, :1; } sim_ucon_t;
+typedef struct { unsigned char URSTIF:1, UERRIF:1, ACTVIF:1, TRNIF:1, IDLEIF:1, STALLIF:1, SOFIF:1, :1; } sim_uir_t;
+
+// Whole registers
+#define OSCCON      SIM_REG(SIM_OSCCON)
+#define OSCSTAT     SIM_REG(SIM_OSCSTAT)
+#define ACTCON      SIM_REG(SIM_ACTCON)
+#define OPTION_REG  SIM_REG(SIM_OPTION_REG)
+#define INTCON      SIM_REG(SIM_INTCON)
+#define PIR1        SIM_REG(SIM_PIR1)
+#define PIR2        SIM_REG(SIM_PIR2)
+#define PIE1        SIM_REG(SIM_PIE1)
+#define PIE2        SIM_REG(SIM_PIE2)
+#define PORTA       SIM_REG(SIM_PORTA)
+#define PORTB       SIM_REG(SIM_PORTB)
+#define PORTC       SIM_REG(SIM_PORTC)
+#define LATA        SIM_REG(SIM_LATA)
+#define LATB        SIM_REG(SIM_LATB)
+#define LATC        SIM_REG(SIM_LATC)
+#define TRISA       SIM_REG(SIM_TRISA)
+#define TRISB       SIM_REG(SIM_TRISB)
+#define TRISC       SIM_REG(SIM_TRISC)
+#define ANSELA      SIM_REG(SIM_ANSELA)
+#define ANSELB      SIM_REG(SIM_ANSELB)
+#define ANSELC      SIM_REG(SIM_ANSELC)
+#define WPUA        SIM_REG(SIM_WPUA)
+#define WPUB        SIM_REG(SIM_WPUB)
+#define FVRCON      SIM_REG(SIM_FVRCON)
+#define ADCON0      SIM_REG(SIM_ADCON0)
+#define ADCON1      SIM_REG(SIM_ADCON1)
+#define ADCON2      SIM_REG(SIM_ADCON2)
+#define ADRESH      SIM_REG(SIM_ADRESH)
+#define ADRESL      SIM_REG(SIM_ADRESL)
+#define TMR0        SIM_REG(SIM_TMR0)
+#define TMR1L       SIM_REG(SIM_TMR1L)
+#define TMR1H       SIM_REG(SIM_TMR1H)
+#define TMR1        (*sim_sfr16(SIM_TMR1L))
+#define T1CON       SIM_REG(SIM_T1CON)
+#define T1GCON      SIM_REG(SIM_T1GCON)
+#define TMR2        SIM_REG(SIM_TMR2)
+#define PR2         SIM_REG(SIM_PR2)
+#define T2CON       SIM_REG(SIM_T2CON)
+#define PWM1CON     SIM_REG(SIM_PWM1CON)
+#define PWM1DCH     SIM_REG(SIM_PWM1DCH)
+#define PWM1DCL     SIM_REG(SIM_PWM1DCL)
+#define PWM2CON     SIM_REG(SIM_PWM2CON)
+#define PWM2DCH     SIM_REG(SIM_PWM2DCH)
+#define PWM2DCL     SIM_REG(SIM_PWM2DCL)
+#define TXREG       SIM_REG(SIM_TXREG)
+#define TXSTA       SIM_REG(SIM_TXSTA)
+#define RCSTA       SIM_REG(SIM_RCSTA)
+#define BAUDCON     SIM_REG(SIM_BAUDCON)
+#define SPBRGL      SIM_REG(SIM_SPBRGL)
+#define SPBRGH      SIM_REG(SIM_SPBRGH)
+#define PMADRL      SIM_REG(SIM_PMADRL)
+#define PMADRH      SIM_REG(SIM_PMADRH)
+#define PMDATL      SIM_REG(SIM_PMDATL)
+#define PMDATH      SIM_REG(SIM_PMDATH)
+#define PMCON1      SIM_REG(SIM_PMCON1)
+#define PMCON2      SIM_REG(SIM_PMCON2)
+#define UCON        SIM_REG(SIM_UCON)
+#define UCFG        SIM_REG(SIM_UCFG)
+#define USTAT       SIM_REG(SIM_USTAT)
+#define UIR         SIM_REG(SIM_UIR)
+#define UIE         SIM_REG(SIM_UIE)
+#define UADDR       SIM_REG(SIM_UADDR)
+#define UEP0        SIM_REG(SIM_UEP0)
+#define UEP1        SIM_REG(SIM_UEP1)
+#define UEP2        SIM_REG(SIM_UEP2)
+
+// Registers accessed through their bits
+#define PORTAbits   SIM_BITS(sim_porta_t, SIM_PORTA)
+#define LATAbits    SIM_BITS(sim_lata_t, SIM_LATA)
+#define TRISAbits   SIM_BITS(sim_trisa_t, SIM_TRISA)
+#define PORTBbits   SIM_BITS(sim_portb_t, SIM_PORTB)
+#define LATBbits    SIM_BITS(sim_latb_t, SIM_LATB)
+#define TRISBbits   SIM_BITS(sim_trisb_t, SIM_TRISB)
+#define PORTCbits   SIM_BITS(sim_portc_t, SIM_PORTC)
+#define LATCbits    SIM_BITS(sim_latc_t, SIM_LATC)
+#define TRISCbits   SIM_BITS(sim_trisc_t, SIM_TRISC)
+#define ANSELCbits  SIM_BITS(sim_anselc_t, SIM_ANSELC)
+#define INTCONbits  SIM_BITS(sim_intcon_t, SIM_INTCON)
+#define OPTION_REGbits SIM_BITS(sim_option_t, SIM_OPTION_REG)
+#define PIR1bits    SIM_BITS(sim_pir1_t, SIM_PIR1)
+#define PIE1bits    SIM_BITS(sim_pie1_t, SIM_PIE1)
+#define PIR2bits    SIM_BITS(sim_pir2_t, SIM_PIR2)
+#define PIE2bits    SIM_BITS(sim_pie2_t, SIM_PIE2)
+#define ADCON0bits  SIM_BITS(sim_adcon0_t, SIM_ADCON0)
+#define ADCON1bits  SIM_BITS(sim_adcon1_t, SIM_ADCON1)
+#define T1CONbits   SIM_BITS(sim_t1con_t, SIM_T1CON)
+#define T2CONbits   SIM_BITS(sim_t2con_t, SIM_T2CON)
+#define OSCSTATbits SIM_BITS(sim_oscstat_t, SIM_OSCSTAT)
+#define TXSTAbits   SIM_BITS(sim_txsta_t, SIM_TXSTA)
+#define PMCON1bits  SIM_BITS(sim_pmcon1_t, SIM_PMCON1)
+#define UCONbits    SIM_BITS(sim_ucon_t, SIM_UCON)
+#define UIRbits     SIM_BITS(sim_uir_t, SIM_UIR)
+
+// Individual bits, named as XC8 names them
+#define GIE         INTCONbits.GIE
+#define PEIE        INTCONbits.PEIE
+#define TMR0IE      INTCONbits.TMR0IE
+#define TMR0IF      INTCONbits.TMR0IF
+#define INTE        INTCONbits.INTE
+#define INTF        INTCONbits.INTF
+#define IOCIE       INTCONbits.IOCIE
+#define IOCIF       INTCONbits.IOCIF
+#define INTEDG      OPTION_REGbits.INTEDG
+#define TMR0CS      OPTION_REGbits.TMR0CS
+#define PSA         OPTION_REGbits.PSA
+#define ADIF        PIR1bits.ADIF
+#define TXIF        PIR1bits.TXIF
+#define TMR2IF      PIR1bits.TMR2IF
+#define TMR1IF      PIR1bits.TMR1IF
+#define ADIE        PIE1bits.ADIE
+#define TXIE        PIE1bits.TXIE
+#define TMR2IE      PIE1bits.TMR2IE
+#define TMR1IE      PIE1bits.TMR1IE
+#define USBIF       PIR2bits.USBIF
+#define USBIE       PIE2bits.USBIE
+#define GO          ADCON0bits.GO
+#define GO_nDONE    ADCON0bits.GO
+#define ADGO        ADCON0bits.GO
+#define ADON        ADCON0bits.ADON
+#define ADFM        ADCON1bits.ADFM
+#define TMR1ON      T1CONbits.TMR1ON
+#define TMR2ON      T2CONbits.TMR2ON
+#define PLLRDY      OSCSTATbits.PLLRDY
+#define TRMT        TXSTAbits.TRMT
+#define RD          PMCON1bits.RD
+#define WR          PMCON1bits.WR
+#define WREN        PMCON1bits.WREN
+#define FREE        PMCON1bits.FREE
+#define LWLO        PMCON1bits.LWLO
+#define CFGS        PMCON1bits.CFGS
+#define PPBRST      UCONbits.PPBRST
+#define PKTDIS      UCONbits.PKTDIS
+#define USBEN       UCONbits.USBEN
+#define TRNIF       UIRbits.TRNIF
+#define URSTIF      UIRbits.URSTIF
+
+#endif
@@ -0,0 +1,332 @@
+/*==============================================================================
+ Program:   Stream-Decode
+ Date:      October 17, 2026
+ 
+ Reference decoder for the framed binary sample stream sent by the
+ Sample-Stream.c library. Reads the stream from a serial port (or a file, or
+ standard input), checks each frame's CRC-8, reports frames that were lost
+ using the frame sequence numbers, and prints the decoded samples as text:
+ 
+   <sequence> <channel> <sample> <sample> ...
+ 
+ Both packed and compressed frames are decoded. Compressed frames are shown
+ with their channel ID's compression flag (bit 7) cleared.
+ 
+ Build and run on Linux with:
+ 
+   cc -O2 -o stream-decode Stream-Decode.c
+   ./stream-decode /dev/ttyUSB0 9600
+ 
+ A summary of good, corrupt, and lost frames is printed to stderr at the end
+ of the input, or when the program is stopped with Ctrl-C, along with the
+ average number of bytes per sample and the compression ratio compared to
+ 5-byte ASCII samples and to packed 10-bit frames. Running it on a recorded
+ stream (e.g. saved with 'cat /dev/ttyUSB0 > trace.bin') compares the
+ compressed and packed formats for that signal.
+==============================================================================*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define FRAME_MAX   256         // Longest COBS-encoded frame accepted
+
+static const unsigned char crcTable[16] = {
+    0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
+    0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d
+};
+
+static unsigned long goodFrames;
+static unsigned long badFrames;
+static unsigned long lostFrames;
+static unsigned long streamBytes;
+static unsigned long streamSamples;
+static volatile sig_atomic_t stop;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    stop = 1;
+}
+
+// Calculate the CRC-8 (polynomial 0x07) of a block of bytes
+static unsigned char crc8(const unsigned char *data, size_t length)
+{
+    unsigned char crc = 0;
+    
+    while(length--)
+    {
+        crc ^= *data++;
+        crc = crcTable[crc >> 4] ^ (unsigned char)(crc << 4);
+        crc = crcTable[crc >> 4] ^ (unsigned char)(crc << 4);
+    }
+    return crc;
+}
+
+// Decode a COBS block (without its 0 delimiter). Returns the decoded length,
+// or 0 if the encoding is invalid.
+static size_t cobs_decode(const unsigned char *in, size_t length, unsigned char *out)
+{
+    size_t i = 0;
+    size_t o = 0;
+    
+    while(i < length)
+    {
+        unsigned char code = in[i++];
+        
+        if(code == 0 || i + code - 1 > length)
+        {
+            return 0;
+        }
+        for(unsigned char n = 1; n < code; n++)
+        {
+            out[o++] = in[i++];
+        }
+        if(code != 0xff && i < length)
+        {
+            out[o++] = 0;
+        }
+    }
+    return o;
+}
+
+// Return the 4-bit code at position n of a compressed frame's code stream
+static unsigned int code_at(const unsigned char *codes, size_t n)
+{
+    return (n & 1) ? (codes[n >> 1] & 0x0f) : (codes[n >> 1] >> 4);
+}
+
+// Decode and print the samples of a compressed frame. Returns 0 if the codes
+// don't produce the number of samples in the frame header.
+static int print_compressed(const unsigned char *frame, size_t length)
+{
+    const unsigned char *codes = frame + 5;
+    size_t available = (length - 6) * 2;    // Codes between header and CRC
+    size_t n = 0;
+    unsigned int count = frame[2];
+    unsigned int sample = ((frame[3] & 0x03) << 8) | frame[4];
+    unsigned int printed = 1;
+    
+    if(count == 0)
+    {
+        return 0;
+    }
+    printf(" %u", sample);
+    while(printed < count)
+    {
+        unsigned int code;
+        
+        if(n >= available)
+        {
+            return 0;
+        }
+        code = code_at(codes, n++);
+        if(code != 0x8)
+        {
+            sample = (sample + (code < 8 ? code : code - 16)) & 0x3ff;
+            printf(" %u", sample);
+            printed++;
+            continue;
+        }
+        if(n >= available)
+        {
+            return 0;
+        }
+        code = code_at(codes, n++);
+        if(code == 0)           // Escaped full sample
+        {
+            if(n + 3 > available)
+            {
+                return 0;
+            }
+            sample = (code_at(codes, n) << 8) | (code_at(codes, n + 1) << 4) | code_at(codes, n + 2);
+            n += 3;
+            printf(" %u", sample);
+            printed++;
+        }
+        else                    // Run of repeated samples
+        {
+            for(unsigned int r = code + 2; r != 0 && printed < count; r--)
+            {
+                printf(" %u", sample);
+                printed++;
+            }
+        }
+    }
+    return 1;
+}
+
+// Check, unpack, and print one decoded frame
+static void frame_received(const unsigned char *frame, size_t length)
+{
+    static int haveSequence;
+    static unsigned char lastSequence;
+    size_t data = 2;            // Start of the first sample group
+    size_t end;
+    
+    if(length < 5 || crc8(frame, length - 1) != frame[length - 1])
+    {
+        badFrames++;
+        return;
+    }
+    if((frame[1] & 0x80) && length < 7)
+    {
+        badFrames++;
+        return;
+    }
+    if(haveSequence)
+    {
+        lostFrames += (unsigned char)(frame[0] - lastSequence - 1);
+    }
+    haveSequence = 1;
+    lastSequence = frame[0];
+    goodFrames++;
+    
+    printf("%u %u", frame[0], frame[1] & 0x7f);
+    if(frame[1] & 0x80)
+    {
+        if(!print_compressed(frame, length))
+        {
+            printf(" (bad compressed data)");
+        }
+        else
+        {
+            streamSamples += frame[2];
+        }
+        printf("\n");
+        fflush(stdout);
+        return;
+    }
+    end = length - 1;
+    while(data < end)
+    {
+        size_t group = end - data;      // Bytes in this group, up to 5
+        
+        if(group > 5)
+        {
+            group = 5;
+        }
+        for(size_t s = 0; s + 1 < group; s++)
+        {
+            unsigned int high = (frame[data + group - 1] >> (s * 2)) & 0x03;
+            printf(" %u", (high << 8) | frame[data + s]);
+            streamSamples++;
+        }
+        data += group;
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+// Put a serial port into raw mode at the requested bit rate
+static int serial_setup(int fd, long baud)
+{
+    struct termios tio;
+    speed_t speed;
+    
+    switch(baud)
+    {
+        case 9600:   speed = B9600;   break;
+        case 19200:  speed = B19200;  break;
+        case 38400:  speed = B38400;  break;
+        case 57600:  speed = B57600;  break;
+        case 115200: speed = B115200; break;
+        case 230400: speed = B230400; break;
+        default:
+            fprintf(stderr, "unsupported bit rate %ld\n", baud);
+            return -1;
+    }
+    if(tcgetattr(fd, &tio) != 0)
+    {
+        return 0;               // Not a terminal - read it as a file
+    }
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    return tcsetattr(fd, TCSANOW, &tio);
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned char encoded[FRAME_MAX];
+    unsigned char frame[FRAME_MAX];
+    size_t length = 0;
+    int overlong = 0;
+    int fd = STDIN_FILENO;
+    
+    if(argc > 1 && strcmp(argv[1], "-") != 0)
+    {
+        fd = open(argv[1], O_RDONLY | O_NOCTTY);
+        if(fd < 0)
+        {
+            fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+            return 1;
+        }
+        if(serial_setup(fd, argc > 2 ? strtol(argv[2], NULL, 10) : 9600) != 0)
+        {
+            return 1;
+        }
+    }
+    signal(SIGINT, on_signal);
+    
+    while(!stop)
+    {
+        unsigned char buffer[256];
+        ssize_t count = read(fd, buffer, sizeof buffer);
+        
+        if(count <= 0)
+        {
+            break;
+        }
+        streamBytes += (unsigned long)count;
+        for(ssize_t i = 0; i < count; i++)
+        {
+            if(buffer[i] != 0)
+            {
+                if(length < FRAME_MAX)
+                {
+                    encoded[length++] = buffer[i];
+                }
+                else
+                {
+                    overlong = 1;
+                }
+                continue;
+            }
+            if(length != 0)     // End of a frame
+            {
+                size_t decoded = overlong ? 0 : cobs_decode(encoded, length, frame);
+                
+                if(decoded != 0)
+                {
+                    frame_received(frame, decoded);
+                }
+                else
+                {
+                    badFrames++;
+                }
+            }
+            length = 0;
+            overlong = 0;
+        }
+    }
+    fprintf(stderr, "%lu good frames, %lu corrupt frames, %lu lost frames\n",
+            goodFrames, badFrames, lostFrames);
+    if(streamSamples != 0)
+    {
+        double perSample = (double)streamBytes / streamSamples;
+        
+        fprintf(stderr, "%lu bytes, %lu samples, %.3f bytes/sample, "
+                "%.2fx smaller than ASCII, %.2fx smaller than 32-sample packed frames\n",
+                streamBytes, streamSamples, perSample, 5.0 / perSample,
+                (45.0 / 32.0) / perSample);
+    }
+    return 0;
+}
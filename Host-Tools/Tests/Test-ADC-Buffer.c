@@ -0,0 +1,88 @@
+/*==============================================================================
+ Test:      Test-ADC-Buffer
+ Date:      October 17, 2026
+
+ Host simulator tests of the ADC sample ring buffer filled by ADC_isr().
+ Each conversion returns the next number of a 10-bit count, so any lost,
+ repeated or reordered sample shows up as a gap in the sequence read back.
+==============================================================================*/
+
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+
+static unsigned int count;
+
+static unsigned int next_count(unsigned char channel)
+{
+    (void)channel;
+    return (count++ & 0x3FF);
+}
+
+static void isr(void)
+{
+    ADC_isr();
+}
+
+int main(void)
+{
+    unsigned int expected = 0;
+    unsigned int read = 0;
+    unsigned int gaps = 0;
+    unsigned char overruns;
+    unsigned int sample;
+
+    sim_reset();
+    sim_set_isr(isr);
+    OSC_config();
+    UBMP4_config();
+    ADC_config();
+    sim_adc_source(next_count);
+
+    // Keep the buffer one sample from full at 20 kHz: each sample is read
+    // only after ADC_BUFFER_SIZE - 1 newer ones have been stored
+    ADC_start_timed_sampling(ANQ1, 20000);
+    while(read < 2000)
+    {
+        sim_run(1);
+        if(ADC_samples_available() >= ADC_BUFFER_SIZE - 1)
+        {
+            sample = ADC_get_sample() >> 6;
+            gaps += (sample != (expected & 0x3FF));
+            expected = sample + 1;
+            read ++;
+        }
+    }
+    sim_check(gaps == 0, "no samples lost with the buffer near full");
+    sim_check(ADC_overruns == 0, "no overruns with the buffer near full");
+    sim_check(ADC_samples_available() <= ADC_BUFFER_SIZE, "available count in range");
+
+    // Stop reading for 40 sample periods: the buffer fills, and each newer
+    // sample is discarded and counted
+    sim_run(40 * 600);
+    overruns = ADC_overruns;
+    sim_check(ADC_samples_available() == ADC_BUFFER_SIZE, "buffer full");
+    sim_check(overruns >= 20, "overruns counted while full");
+
+    // The stored samples are still in order, and the first new sample after
+    // draining follows the gap left by the overruns
+    for(unsigned char i = 0; i != ADC_BUFFER_SIZE; i++)
+    {
+        sample = ADC_get_sample() >> 6;
+        gaps += (sample != (expected & 0x3FF));
+        expected = sample + 1;
+    }
+    sim_check(gaps == 0, "full buffer contents in order");
+    sim_check(ADC_samples_available() == 0 && ADC_get_sample() == 0, "empty after draining");
+    while(ADC_samples_available() == 0)
+    {
+        sim_run(1);
+    }
+    ADC_stop_sampling();
+    sample = ADC_get_sample() >> 6;
+    sim_check(((sample - expected) & 0x3FF) == ADC_overruns, "gap after draining equals overruns");
+
+    return (sim_failures != 0);
+}
@@ -0,0 +1,122 @@
+/*==============================================================================
+ Test:      Test-ADC
+ Date:      October 17, 2026
+
+ Host simulator tests of the UBMP4.c ADC functions: polled 8- and 10-bit
+ reads, invalid channels, Sleep conversions, the TMR2-timed sample rate, and
+ the compile-time TMR2 settings for constant rates.
+==============================================================================*/
+
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+
+// Temperature indicator scanned with too short an acquisition time
+const ADC_scan_entry_t scanList[2] = {
+    {ANTIM, 5, 0},
+    {ANQ1, 5, 0}
+};
+
+// Start a constant rate with ADC_START_TIMED_SAMPLING() and check that it
+// sets up TMR2 the same way as ADC_start_timed_sampling() does at run time
+#define ADC_CHECK_CONSTANT_RATE(rate) \
+    do { \
+        unsigned char t2con, pr2; \
+        unsigned int actual = ADC_START_TIMED_SAMPLING(ANQ1, rate); \
+        t2con = T2CON; \
+        pr2 = PR2; \
+        sim_check(ADC_start_timed_sampling(ANQ1, rate) == actual && \
+                T2CON == t2con && PR2 == pr2, "constant rate " #rate); \
+        ADC_stop_sampling(); \
+    } while(0)
+
+static void isr(void)
+{
+    ADC_isr();
+}
+
+int main(void)
+{
+    unsigned long start;
+    unsigned int samples = 0;
+    unsigned int rate;
+
+    sim_reset();
+    sim_set_isr(isr);
+    OSC_config();
+    UBMP4_config();
+    ADC_config();
+
+    // Polled reads
+    sim_adc_set(ANQ1 >> 2, 0x2C5);
+    sim_check(ADC_read_channel(ANQ1) == 0xB1, "8-bit read is the upper 8 bits");
+    sim_check(ADC_read_channel_10bit(ANQ1) == 0x2C5, "10-bit read");
+    sim_check(ADON == 0, "ADC turned off after a read");
+    start = sim_cycle;
+    ADC_read_channel_10bit(ANTIM);
+    sim_check(sim_cycle - start >= 200 * 12, "ANTIM read waits 200us to acquire");
+
+    // Invalid channels return at once without converting. AN4 + 0x80 would
+    // use AN4's table entry if only the CHS bits were looked at.
+    start = sim_conversions;
+    sim_check(ADC_read_channel(AN4 | 0b00000001) == 0, "8-bit read of an invalid channel");
+    sim_check(ADC_read_channel_10bit(AN4 + 0x80) == ADC_INVALID, "10-bit read of an invalid channel");
+    sim_check(ADC_read_channel_sleep(0) == ADC_INVALID && sim_sleeps == 0, "Sleep read of an invalid channel");
+    sim_check(ADC_start_timed_sampling(0b01111100, 1000) == 0, "timed sampling of an invalid channel");
+    sim_check(sim_conversions == start && ADON == 0, "no conversions of invalid channels");
+    sim_check(ADC_acquisition_time(AN4 + 0x80) == 0 && ADC_acquisition_time(ANTIM) == 200,
+            "acquisition times");
+
+    // Sleep conversion
+    sim_adc_set(ANH1 >> 2, 0x155);
+    sim_check(ADC_read_channel_sleep(ANH1) == 0x155, "Sleep conversion result");
+    sim_check(sim_sleeps == 1, "Sleep conversion used SLEEP()");
+    TMR1ON = 1;
+    sim_check(ADC_read_channel_sleep(ANH1) == 0x155, "awake conversion result");
+    sim_check(sim_sleeps == 1, "no SLEEP() while TMR1 is running");
+    TMR1ON = 0;
+
+    // Timed sampling at 1 kHz for 100ms
+    rate = ADC_start_timed_sampling(ANQ1, 1000);
+    sim_check(rate > 990 && rate < 1010, "1 kHz timed sampling");
+    start = sim_cycle;
+    while(sim_cycle - start < 1200000)
+    {
+        sim_run(100);
+        while(ADC_samples_available() != 0)
+        {
+            if((ADC_get_sample() >> 6) == 0x2C5)
+            {
+                samples ++;
+            }
+        }
+    }
+    ADC_stop_sampling();
+    sim_check(samples >= 99 && samples <= 101, "100 samples in 100ms");
+    sim_check(ADC_overruns == 0, "no ring buffer overruns");
+
+    // Constant rates get the same TMR2 settings and actual rate as the run
+    // time search, for the auto-trigger and the postscaler ranges
+    ADC_CHECK_CONSTANT_RATE(46);
+    ADC_CHECK_CONSTANT_RATE(100);
+    ADC_CHECK_CONSTANT_RATE(733);
+    ADC_CHECK_CONSTANT_RATE(1000);
+    ADC_CHECK_CONSTANT_RATE(5000);
+    ADC_CHECK_CONSTANT_RATE(10000);
+    ADC_CHECK_CONSTANT_RATE(20000);
+    sim_check(ADC_START_TIMED_SAMPLING(0b01111100, 1000) == 0, "constant rate of an invalid channel");
+    ADC_stop_sampling();
+
+    // Scan entries can't shorten a channel's minimum acquisition time
+    sim_check(ADC_start_scan(scanList, 2, false), "scan started");
+    sim_check(PR2 == 149, "ANTIM scanned with its 200us acquisition time");
+    while(!ADC_scan_complete())
+    {
+        sim_run(100);
+    }
+    ADC_stop_sampling();
+
+    return (sim_failures != 0);
+}
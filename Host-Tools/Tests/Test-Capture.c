@@ -0,0 +1,85 @@
+/*==============================================================================
+ Test:      Test-Capture
+ Date:      October 17, 2026
+
+ Host simulator tests of the Capture.c burst capture: rates limited by each
+ channel's acquisition time, a trigger found after more than 65535 samples
+ with no timeout, the position of the pre-trigger samples in a 512 sample
+ buffer, and a timeout without a trigger.
+==============================================================================*/
+
+// CFLAGS: -DCAPTURE_SAMPLES=512
+
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Capture.h"
+
+// Capture buffer and results in Capture.c
+extern unsigned char captureBuffer[CAPTURE_SAMPLES];
+extern unsigned int captureStart;
+extern unsigned int captureCount;
+
+#define SAMPLE_CYCLES   280     // Instruction cycles per sample at 42857/s
+
+unsigned long stepCycle;        // Cycle the input steps from 0 to full scale
+
+// ADC input, a step from 0 to 1023 at stepCycle
+static unsigned int step_input(unsigned char channel)
+{
+    (void)channel;
+    return ((sim_cycle >= stepCycle) ? 1023 : 0);
+}
+
+// Return a sample counted from the oldest one in the capture buffer
+static unsigned char captured(unsigned int sample)
+{
+    return (captureBuffer[(captureStart + sample) & (CAPTURE_SAMPLES - 1)]);
+}
+
+int main(void)
+{
+    unsigned long start;
+
+    sim_reset();
+    OSC_config();
+    UBMP4_config();
+    ADC_config();
+    sim_adc_source(step_input);
+    sim_check(capture_config(ANQ1, 50000) == 0, "50000 samples/s leaves too little acquisition time");
+    sim_check(capture_config(ANTIM, 5000) == 0, "temperature indicator too fast at 5000 samples/s");
+    sim_check(capture_config(ANTIM, 4000) == 3989, "temperature indicator at 4000 samples/s (3989)");
+    sim_check(capture_config(ANQ1, CAPTURE_MAX_RATE) == 42857, "42857 samples/s capture rate");
+
+    // A rising edge after 70000 samples, longer than a 16-bit sample count
+    capture_trigger(CAPTURE_RISING, 128, 32);
+    stepCycle = sim_cycle + 70000UL * SAMPLE_CYCLES;
+    sim_check(capture_run(0), "timeout of 0 waits for a late trigger");
+    sim_check(sim_cycle > stepCycle, "capture continued until the trigger");
+    sim_check(captureCount == CAPTURE_SAMPLES, "full buffer after the trigger");
+    sim_check(captured(31) == 0 && captured(32) == 255, "trigger after 32 pre-trigger samples");
+
+    // More pre-trigger samples than an 8-bit index can hold
+    capture_trigger(CAPTURE_RISING, 128, 300);
+    stepCycle = sim_cycle + 1000UL * SAMPLE_CYCLES;
+    sim_check(capture_run(0), "trigger with 300 pre-trigger samples");
+    sim_check(captured(299) == 0 && captured(300) == 255 && captured(CAPTURE_SAMPLES - 1) == 255,
+            "trigger after 300 pre-trigger samples");
+    capture_trigger(CAPTURE_RISING, 128, 32);
+
+    // No trigger before the timeout
+    stepCycle = ~0UL;
+    start = sim_cycle;
+    sim_check(!capture_run(1000), "no trigger times out");
+    sim_check(sim_cycle - start >= 999UL * SAMPLE_CYCLES && sim_cycle - start < 1001UL * SAMPLE_CYCLES,
+            "timed out after 1000 samples");
+    sim_check(captureCount == CAPTURE_SAMPLES, "timeout keeps the latest samples");
+
+    // A timeout before the buffer fills keeps the samples collected
+    sim_check(!capture_run(100), "short timeout");
+    sim_check(captureCount == 100 && captureStart == 0, "100 samples kept");
+
+    return (sim_failures != 0);
+}
@@ -0,0 +1,191 @@
+/*==============================================================================
+ Test:      Test-Filter
+ Date:      October 17, 2026
+
+ Host tests of the ADC-Filter outputs against reference values: the moving
+ averages and medians against sums and sorts of the same windows, the EMA
+ step response against the exact exponential, spike rejection by the
+ medians, and the limits applied to the shift by filter_config().
+==============================================================================*/
+
+#include    <stdlib.h>
+#include    <math.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "ADC-Filter.h"
+
+#define SAMPLES     1000
+
+unsigned int samples[SAMPLES];
+
+// Return the value of sample n, repeating the first sample before the start
+// like the filter's history does
+static unsigned int sample_at(int n)
+{
+    return (samples[(n < 0) ? 0 : n]);
+}
+
+// Return the median of the window of samples ending at sample n
+static unsigned int reference_median(int n, int taps)
+{
+    unsigned int window[5];
+    unsigned int temp;
+
+    for(int i = 0; i != taps; i++)
+    {
+        window[i] = sample_at(n - i);
+    }
+    for(int i = 1; i != taps; i++)      // Insertion sort
+    {
+        for(int j = i; j != 0 && window[j] < window[j - 1]; j--)
+        {
+            temp = window[j];
+            window[j] = window[j - 1];
+            window[j - 1] = temp;
+        }
+    }
+    return (window[taps / 2]);
+}
+
+// Return true if a filter's output matches the reference for every sample
+static bool check_window(unsigned char type, unsigned char shift)
+{
+    unsigned long sum;
+    unsigned int expected;
+    bool match = true;
+
+    filter_config(0, type, shift);
+    for(int n = 0; n != SAMPLES; n++)
+    {
+        if(type == FILTER_AVERAGE)
+        {
+            sum = 0;
+            for(int i = 0; i != 1 << shift; i++)
+            {
+                sum += sample_at(n - i);
+            }
+            expected = (unsigned int)(sum >> shift);
+        }
+        else if(type == FILTER_MEDIAN3)
+        {
+            expected = reference_median(n, 3);
+        }
+        else if(type == FILTER_MEDIAN5)
+        {
+            expected = reference_median(n, 5);
+        }
+        else
+        {
+            expected = samples[n];
+        }
+        match = (filter_sample(0, samples[n]) == expected) && match;
+    }
+    return (match);
+}
+
+// Return the largest difference between the EMA's response to a step from
+// 0 to 1000 and the exact exponential 1000 x (1 - (1 - 1/2^shift)^(n + 1)),
+// and the number of samples it takes to settle at 1000
+static double check_ema_step(unsigned char shift, unsigned int *settle)
+{
+    double alpha = 1.0 / (1 << shift);
+    double error = 0;
+    unsigned int result;
+
+    filter_config(1, FILTER_EMA, shift);
+    filter_sample(1, 0);
+    *settle = 0;
+    for(unsigned int n = 0; n != 1000; n++)
+    {
+        result = filter_sample(1, 1000);
+        error = fmax(error, fabs(result - 1000 * (1 - pow(1 - alpha, n + 1))));
+        if(result != 1000)
+        {
+            *settle = n + 1;
+        }
+    }
+    return (error);
+}
+
+int main(void)
+{
+    unsigned int settle;
+    double error;
+    bool rejected = true;
+
+    // Noisy 10-bit samples with steps and spikes
+    srand(1);
+    for(int n = 0; n != SAMPLES; n++)
+    {
+        samples[n] = ((n / 100) & 1) ? 700 : 300;
+        samples[n] += rand() % 33 - 16;
+        if(rand() % 20 == 0)
+        {
+            samples[n] = rand() % 1024;
+        }
+    }
+
+    // Moving averages and medians against the same windows
+    sim_check(check_window(FILTER_NONE, 0), "no filter passes samples through");
+    sim_check(check_window(FILTER_AVERAGE, 0), "average of 1 sample");
+    sim_check(check_window(FILTER_AVERAGE, 2), "average of 4 samples");
+    sim_check(check_window(FILTER_AVERAGE, 4), "average of 16 samples");
+    sim_check(check_window(FILTER_MEDIAN3, 0), "median of 3 samples");
+    sim_check(check_window(FILTER_MEDIAN5, 0), "median of 5 samples");
+
+    // A window larger than the history is limited to the history
+    filter_config(0, FILTER_AVERAGE, 7);
+    filter_sample(0, 0);
+    for(int i = 0; i != FILTER_HISTORY - 1; i++)
+    {
+        filter_sample(0, 1000);
+    }
+    sim_check(filter_sample(0, 1000) == 1000, "average window limited to FILTER_HISTORY");
+
+    // Medians of known windows, including ties, and spike rejection
+    filter_config(2, FILTER_MEDIAN3, 0);
+    filter_sample(2, 10);
+    sim_check(filter_sample(2, 30) == 10 && filter_sample(2, 20) == 20, "median of 3 known windows");
+    sim_check(filter_sample(2, 20) == 20 && filter_sample(2, 5) == 20, "median of 3 with ties");
+    filter_config(3, FILTER_MEDIAN5, 0);
+    filter_sample(3, 50);
+    sim_check(filter_sample(3, 40) == 50 && filter_sample(3, 10) == 50 && filter_sample(3, 30) == 40
+            && filter_sample(3, 20) == 30, "median of 5 known windows");
+    for(int n = 0; n != 40; n++)
+    {
+        unsigned int sample = (n % 10 == 5) ? 1023 : 500;
+
+        rejected = rejected && filter_sample(2, sample) == ((n == 0) ? 20 : 500);
+    }
+    sim_check(rejected, "median of 3 rejects single spikes");
+    filter_config(3, FILTER_MEDIAN5, 0);
+    rejected = true;
+    for(int n = 0; n != 40; n++)
+    {
+        unsigned int sample = (n % 10 == 5 || n % 10 == 6) ? 0 : 500;
+
+        rejected = rejected && filter_sample(3, sample) == 500;
+    }
+    sim_check(rejected, "median of 5 rejects pairs of spikes");
+
+    // EMA step responses against the exact exponential. Keeping the fraction
+    // in the shifted state holds the output to within 1 LSB of it, and the
+    // output settles at exactly 1000 in about 7 x 2^shift samples.
+    error = check_ema_step(1, &settle);
+    sim_check(error < 1 && settle < 16, "EMA 1/2 step response");
+    error = check_ema_step(2, &settle);
+    sim_check(error < 1 && settle < 32, "EMA 1/4 step response");
+    error = check_ema_step(4, &settle);
+    sim_check(error < 1 && settle < 128, "EMA 1/16 step response");
+    error = check_ema_step(6, &settle);
+    sim_check(error < 1 && settle < 512, "EMA 1/64 step response");
+
+    // The first sample fills the EMA, and the weight is limited to 1/64
+    filter_config(1, FILTER_EMA, 9);
+    sim_check(filter_sample(1, 1023) == 1023 && filter_sample(1, 1023) == 1023, "EMA starts at the first sample");
+    sim_check(filter_sample(1, 0) == 1023 - 16, "EMA weight limited to 1/64");
+
+    return (sim_failures != 0);
+}
@@ -0,0 +1,101 @@
+/*==============================================================================
+ Test:      Test-H1-Serial
+ Date:      October 17, 2026
+
+ Host simulator tests of the TMR1 interrupt-driven H1 serial output. Frames
+ are decoded from the logged H1 pin changes, and every edge in each frame is
+ checked to be within 2% of a bit period of its ideal time.
+==============================================================================*/
+
+#include    <stdio.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Simple-Serial.h"
+
+#define BIT_CYCLES  ((double)_XTAL_FREQ / 4 / H1_BAUD)
+
+static void isr(void)
+{
+    H1_serial_isr();
+}
+
+// Run until the transmitter has sent everything and stopped
+static void wait_idle(void)
+{
+    while(H1_serial_pending() != 0 || TMR1IE)
+    {
+        sim_run(100);
+    }
+}
+
+int main(void)
+{
+    unsigned char sent[64];
+    unsigned char received[64];
+    unsigned int accepted = 0;
+    unsigned long start;
+    unsigned long end;
+    double edgeError;
+    unsigned int bytes;
+    bool match = true;
+
+    sim_reset();
+    sim_set_isr(isr);
+    OSC_config();
+    UBMP4_config();
+    H1_serial_start();
+    sim_check(H1OUT == 1 && TMR1IE == 0, "idle high with the bit timer stopped");
+
+    // Fill the FIFO. The first byte moves into the frame being sent, so one
+    // more than H1_FIFO_SIZE bytes are accepted before a send fails.
+    start = sim_cycle;
+    for(unsigned int i = 0; i != sizeof(sent); i++)
+    {
+        sent[i] = (unsigned char)(i * 37 + 0x55);
+        if(!H1_serial_send(sent[i]))
+        {
+            break;
+        }
+        accepted ++;
+    }
+    sim_check(accepted == H1_FIFO_SIZE + 1, "FIFO accepts H1_FIFO_SIZE bytes plus the byte being sent");
+    sim_check(H1_serial_pending() == H1_FIFO_SIZE, "pending count when full");
+    sim_check(!H1_serial_send(0), "send fails while full");
+
+    // Once a byte has been sent there is room for one more
+    while(H1_serial_pending() == H1_FIFO_SIZE)
+    {
+        sim_run(100);
+    }
+    sent[accepted] = 0xA5;
+    sim_check(H1_serial_send(sent[accepted]), "send succeeds after a byte is sent");
+    accepted ++;
+
+    // Empty: the timer stops after the last stop bit and the pin stays high
+    wait_idle();
+    end = sim_cycle;
+    sim_check(H1OUT == 1 && TMR1ON == 0 && TMR1IF == 0, "idle high and stopped when empty");
+    sim_check(H1_serial_send(0) && TMR1IE == 1, "send restarts an idle transmitter");
+    wait_idle();
+    sent[accepted++] = 0;
+
+    // Decode the pin log
+    bytes = sim_serial_decode('C', 0, BIT_CYCLES, start, received, sizeof(received), &edgeError);
+    sim_check(bytes == accepted, "all bytes sent as frames");
+    for(unsigned int i = 0; i != bytes && i != accepted; i++)
+    {
+        match = match && (received[i] == sent[i]);
+    }
+    sim_check(match, "frames decode to the bytes sent");
+    sim_check(edgeError <= 0.02, "every edge within 2% of its ideal time");
+    printf("Largest edge error: %.2f%% of a bit\n", edgeError * 100);
+
+    // Queued frames are sent back to back: 10 bits each, plus the time from
+    // the end of the last stop bit until the ISR sees the FIFO is empty
+    sim_check((end - start) < (accepted - 1) * 10 * BIT_CYCLES + 2 * BIT_CYCLES, "no gaps between queued frames");
+
+    return (sim_failures != 0);
+}
@@ -0,0 +1,113 @@
+/*==============================================================================
+ Test:      Test-H1-Write
+ Date:      October 17, 2026
+
+ Host simulator tests of the delay-timed H1_serial_write() at 115200 bps.
+ The host version of each bit write takes the same cycles as the PIC
+ instructions, so every edge must be within 2% of its ideal time. The stop
+ bit must be a full bit period even when the next byte is written straight
+ away, and scheduler ticks that come due during a frame must neither stretch
+ its bits nor be lost.
+==============================================================================*/
+
+// CFLAGS: -DH1_BAUD=115200
+
+#include    <stdio.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Simple-Serial.h"
+#include    "Scheduler.h"
+
+#define BIT_CYCLES  ((_XTAL_FREQ / 4 + H1_BAUD / 2) / H1_BAUD)
+#define ISR_CYCLES  120         // Whole interrupt handler in the -O0 build
+
+static void isr(void)
+{
+    sim_delay(ISR_CYCLES);
+    scheduler_isr();
+}
+
+int main(void)
+{
+    const unsigned char sent[] = {0x00, 0xFF, 0x55, 0xAA, 0x80, 0x01, 0x7E};
+    unsigned char received[sizeof(sent)];
+    unsigned long start;
+    unsigned long stopBit = 0;
+    unsigned long shortestStop = ~0UL;
+    double edgeError;
+    unsigned char frames[200];
+    unsigned int ticks;
+    bool match = true;
+
+    sim_reset();
+    OSC_config();
+    UBMP4_config();
+    H1_serial_config();
+    sim_run(1000);
+
+    // Back-to-back writes
+    start = sim_cycle;
+    for(unsigned char i = 0; i != sizeof(sent); i++)
+    {
+        H1_serial_write(sent[i]);
+    }
+    sim_run(1000);
+
+    sim_check(sim_serial_decode('C', 0, (double)_XTAL_FREQ / 4 / H1_BAUD, start, received, sizeof(received), &edgeError) == sizeof(sent), "all bytes sent as frames");
+    for(unsigned char i = 0; i != sizeof(sent); i++)
+    {
+        match = match && (received[i] == sent[i]);
+    }
+    sim_check(match, "frames decode to the bytes sent");
+    sim_check(edgeError <= 0.02, "every edge within 2% of its ideal time");
+    printf("Largest edge error: %.2f%% of a bit\n", edgeError * 100);
+
+    // Zero bytes are high only for their stop bits. Each stop bit must last
+    // a full bit period until the next start bit.
+    start = sim_cycle;
+    for(unsigned char i = 0; i != 4; i++)
+    {
+        H1_serial_write(0);
+    }
+    for(unsigned long i = 1; i < sim_pin_changes; i++)
+    {
+        bool level = sim_pin_log[i].value & 1;
+
+        if(sim_pin_log[i].cycle < start || level == (sim_pin_log[i - 1].value & 1))
+        {
+            continue;
+        }
+        if(level)
+        {
+            stopBit = sim_pin_log[i].cycle;
+        }
+        else if(stopBit != 0 && sim_pin_log[i].cycle - stopBit < shortestStop)
+        {
+            shortestStop = sim_pin_log[i].cycle - stopBit;
+        }
+    }
+    sim_check(shortestStop >= BIT_CYCLES, "stop bits at least one bit period long");
+    printf("Shortest stop bit: %lu cycles (bit: %u)\n", shortestStop, BIT_CYCLES);
+
+    // Frames sent while the scheduler ticks
+    sim_set_isr(isr);
+    scheduler_start();
+    ticks = scheduler_ticks();
+    start = sim_cycle;
+    for(unsigned int i = 0; i != sizeof(frames); i++)
+    {
+        H1_serial_write((unsigned char)i);
+    }
+    sim_run(SCHED_TICK_CYCLES);
+    ticks = scheduler_ticks() - ticks;
+    sim_check(sim_serial_decode('C', 0, (double)_XTAL_FREQ / 4 / H1_BAUD, start, frames, sizeof(frames), &edgeError) == sizeof(frames), "all frames sent with the tick running");
+    sim_check(edgeError <= 0.02, "ticks don't stretch the bits");
+    printf("Largest edge error with ticks: %.2f%% of a bit\n", edgeError * 100);
+    sim_check(ticks == (sim_cycle - start) / SCHED_TICK_CYCLES || ticks == (sim_cycle - start) / SCHED_TICK_CYCLES + 1, "no ticks lost");
+    printf("Ticks: %u in %lu cycles\n", ticks, sim_cycle - start);
+
+    return (sim_failures != 0);
+}
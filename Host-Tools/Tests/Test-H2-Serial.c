@@ -0,0 +1,159 @@
+/*==============================================================================
+ Test:      Test-H2-Serial
+ Date:      October 17, 2026
+
+ Host simulator tests of the H2 interrupt-driven serial input. Frames are
+ driven onto H2 with the transmitter's clock skewed from H2_BAUD and random
+ jitter added to every edge, and the received bytes and framing error count
+ are checked. Skews of up to 3% must be received without errors, and larger
+ skews must be detected.
+==============================================================================*/
+
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Simple-Serial.h"
+
+#define BIT_CYCLES  ((double)_XTAL_FREQ / 4 / H2_BAUD)
+#define FRAMES      200
+#define JITTER      0.02        // Largest random edge jitter, in bits
+
+// Waveform edges driven onto H2 by the stimulus
+static unsigned long edgeCycle[FRAMES * 11];
+static bool edgeLevel[FRAMES * 11];
+static unsigned int edges;
+static unsigned int nextEdge;
+
+static void stimulus(void)
+{
+    while(nextEdge != edges && edgeCycle[nextEdge] <= sim_cycle)
+    {
+        sim_input('C', 1, edgeLevel[nextEdge]);
+        nextEdge ++;
+    }
+}
+
+static void isr(void)
+{
+    H2_serial_isr();
+}
+
+// Random jitter of up to +/-JITTER of a bit
+static double jitter(void)
+{
+    return ((rand() / (double)RAND_MAX * 2 - 1) * JITTER);
+}
+
+// Make the waveform for a list of bytes sent with a clock that is 'skew'
+// (e.g. 0.03) fast or slow, starting at the cycle 'start'. A stop bit level
+// of false sends a frame with a low stop bit.
+static void make_waveform(const unsigned char *data, unsigned int count, double skew, bool stopLevel, unsigned long start)
+{
+    double bit = BIT_CYCLES * (1 + skew);
+    double t = start;
+    bool level = true;
+
+    edges = nextEdge = 0;
+    for(unsigned int i = 0; i != count; i++)
+    {
+        unsigned int frame = ((unsigned int)data[i] << 1) | ((stopLevel) ? 0x200 : 0);
+
+        for(unsigned char n = 0; n != 10; n++)
+        {
+            bool next = (frame >> n) & 1;
+
+            if(next != level)
+            {
+                edgeCycle[edges] = (unsigned long)(t + (n + ((n != 0) ? jitter() : 0)) * bit);
+                edgeLevel[edges++] = next;
+                level = next;
+            }
+        }
+        if(!level)
+        {
+            edgeCycle[edges] = (unsigned long)(t + 10 * bit);   // Low stop bit:
+            edgeLevel[edges++] = true;          // idle for a bit after it
+            level = true;
+            t += bit;
+        }
+        t += (10 + (rand() % 3)) * bit;     // Stop bit and 0-2 bits of idle
+    }
+}
+
+// Send frames with a skewed clock and return the number received correctly
+static unsigned int receive(const unsigned char *data, unsigned int count, double skew, bool stopLevel)
+{
+    unsigned int correct = 0;
+    unsigned int received = 0;
+
+    make_waveform(data, count, skew, stopLevel, sim_cycle + 1000);
+    while(nextEdge != edges || H2_serial_available() != 0)
+    {
+        sim_run(100);
+        while(H2_serial_available() != 0)
+        {
+            correct += (H2_serial_read() == data[received]);
+            received ++;
+        }
+    }
+    sim_run((unsigned long)(BIT_CYCLES * 12));
+    while(H2_serial_available() != 0)
+    {
+        correct += (H2_serial_read() == data[received]);
+        received ++;
+    }
+    return (correct);
+}
+
+int main(void)
+{
+    static unsigned char data[FRAMES];
+    static const double skews[] = {-0.03, -0.015, 0, 0.015, 0.03};
+    char what[80];
+    unsigned char errors;
+    unsigned int correct;
+
+    sim_reset();
+    sim_set_isr(isr);
+    sim_set_stimulus(stimulus);
+    OSC_config();
+    UBMP4_config();
+    H2_serial_start();
+    srand(1);
+    for(unsigned int i = 0; i != FRAMES; i++)
+    {
+        data[i] = (unsigned char)rand();
+    }
+
+    for(unsigned char i = 0; i != sizeof(skews) / sizeof(skews[0]); i++)
+    {
+        errors = H2_rx_framing_errors;
+        correct = receive(data, FRAMES, skews[i], true);
+        snprintf(what, sizeof(what), "%+.1f%% skew: %u of %u bytes, %u framing errors",
+                skews[i] * 100, correct, FRAMES, (unsigned char)(H2_rx_framing_errors - errors));
+        sim_check(correct == FRAMES && H2_rx_framing_errors == errors, what);
+    }
+
+    // Frames with a low stop bit are counted and not stored
+    errors = H2_rx_framing_errors;
+    correct = receive(data, 10, 0, false);
+    sim_check(correct == 0 && (unsigned char)(H2_rx_framing_errors - errors) == 10, "low stop bits are framing errors");
+
+    // With a 10% slow or fast transmitter the stop bit is sampled almost a
+    // whole bit early or late, so frames must be lost or corrupted
+    for(int sign = -1; sign <= 1; sign += 2)
+    {
+        errors = H2_rx_framing_errors;
+        correct = receive(data, FRAMES, sign * 0.10, true);
+        snprintf(what, sizeof(what), "%+d%% skew detected: %u framing errors, %u of %u bytes correct",
+                sign * 10, (unsigned char)(H2_rx_framing_errors - errors), correct, FRAMES);
+        sim_check(H2_rx_framing_errors != errors && correct < FRAMES, what);
+    }
+    sim_check(H2_rx_overflows == 0, "no FIFO overflows");
+
+    return (sim_failures != 0);
+}
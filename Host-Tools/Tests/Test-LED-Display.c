@@ -0,0 +1,182 @@
+/*==============================================================================
+ Test:      Test-LED-Display
+ Date:      October 17, 2026
+
+ Host simulator tests of the BCM LED display run from the scheduler's TMR0
+ tick: each bit plane is shown for 1, 2 and 4 ticks, the frame repeats every
+ 7 ticks, every LED is on for its level's number of ticks in each frame, the
+ bar graph rounds each value to the nearest of its 28 steps, and RC0-RC3 in
+ LATC are never changed by the display.
+==============================================================================*/
+
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Scheduler.h"
+#include    "LED-Display.h"
+
+#define FRAME_TICKS ((1 << LED_BCM_BITS) - 1)
+#define FRAME_CYCLES ((unsigned long)FRAME_TICKS * SCHED_TICK_CYCLES)
+#define JITTER      64          // Allowed difference in handler latency
+#define LOW_BITS    0b00000101  // RC0-RC3 latch pattern kept by the display
+
+static void isr(void)
+{
+    LED_display_isr();
+    scheduler_isr();
+}
+
+// Return the number of cycles an LATC bit was high between two cycles
+static unsigned long high_cycles(unsigned char bit, unsigned long from, unsigned long to)
+{
+    unsigned long high = 0;
+    unsigned long since = from;
+    bool level = false;
+
+    for(unsigned long i = 0; i != sim_pin_changes && sim_pin_log[i].cycle < to; i++)
+    {
+        if(sim_pin_log[i].port != 'C')
+        {
+            continue;
+        }
+        if(sim_pin_log[i].cycle > from)
+        {
+            if(level)
+            {
+                high += sim_pin_log[i].cycle - since;
+            }
+            since = sim_pin_log[i].cycle;
+        }
+        level = (sim_pin_log[i].value >> bit) & 1;
+    }
+    return (high + (level ? to - since : 0));
+}
+
+// Return true if an LATC bit's high pulses since a cycle last ticks, and
+// repeat once per frame
+static bool check_pulses(unsigned char bit, unsigned int ticks, unsigned long from)
+{
+    unsigned long rise = 0;
+    unsigned long lastRise = 0;
+    unsigned char pulses = 0;
+    bool level = false;
+    bool match = true;
+
+    for(unsigned long i = 0; i != sim_pin_changes; i++)
+    {
+        bool next = (sim_pin_log[i].value >> bit) & 1;
+
+        if(sim_pin_log[i].port != 'C' || sim_pin_log[i].cycle < from || next == level)
+        {
+            level = (sim_pin_log[i].port == 'C') ? next : level;
+            continue;
+        }
+        level = next;
+        if(level)
+        {
+            lastRise = rise;
+            rise = sim_pin_log[i].cycle;
+            if(lastRise != 0)
+            {
+                match = match && rise - lastRise > FRAME_CYCLES - JITTER
+                        && rise - lastRise < FRAME_CYCLES + JITTER;
+            }
+        }
+        else if(rise != 0)
+        {
+            unsigned long width = sim_pin_log[i].cycle - rise;
+
+            match = match && width > (unsigned long)ticks * SCHED_TICK_CYCLES - JITTER
+                    && width < (unsigned long)ticks * SCHED_TICK_CYCLES + JITTER;
+            pulses ++;
+        }
+    }
+    return (match && pulses >= 4);
+}
+
+// Return true if each LED's on time in the next frame (after the frame in
+// progress and the frame that picks up new levels) is its level in ticks
+static bool check_levels(const unsigned char *levels)
+{
+    unsigned long start;
+    bool match = true;
+
+    sim_run(2 * FRAME_CYCLES);
+    start = sim_cycle;
+    sim_run(FRAME_CYCLES);
+    for(unsigned char led = 0; led != LED_COUNT; led++)
+    {
+        unsigned long high = high_cycles(4 + led, start, sim_cycle);
+
+        match = match && (high + SCHED_TICK_CYCLES / 2) / SCHED_TICK_CYCLES == levels[led];
+    }
+    return (match);
+}
+
+int main(void)
+{
+    const unsigned char slices[LED_COUNT] = {1, 2, 4, LED_MAX_LEVEL};
+    unsigned char levels[LED_COUNT];
+    unsigned long start;
+    unsigned long first;
+    bool match = true;
+
+    sim_reset();
+    sim_set_isr(isr);
+    OSC_config();
+    UBMP4_config();
+    LATC = LOW_BITS;
+    first = sim_pin_changes;
+    scheduler_start();
+
+    // Levels of 1, 2 and 4 light each LED for one slice, and the 4th LED is
+    // on for all three
+    LED_display_start(LED_MODE_LEVELS);
+    for(unsigned char led = 0; led != LED_COUNT; led++)
+    {
+        LED_display_level(led, slices[led]);
+    }
+    sim_run(2 * FRAME_CYCLES);
+    start = sim_cycle;
+    sim_run(6 * FRAME_CYCLES);
+    sim_check(check_pulses(4, 1, start), "bit plane 0 shown for 1 tick per frame");
+    sim_check(check_pulses(5, 2, start), "bit plane 1 shown for 2 ticks per frame");
+    sim_check(check_pulses(6, 4, start), "bit plane 2 shown for 4 ticks per frame");
+    sim_check(high_cycles(7, start, sim_cycle) == sim_cycle - start, "full level LED always on");
+    sim_check(check_levels(slices), "on time of each level");
+
+    // Bar graph lengths rounded to the nearest of LED_COUNT x LED_MAX_LEVEL
+    // steps, lit from D2
+    LED_display_start(LED_MODE_BAR);
+    for(unsigned int value = 0; value != 256; value++)
+    {
+        unsigned char length = (unsigned char)((value * LED_COUNT * LED_MAX_LEVEL) / 255.0 + 0.5);
+
+        for(unsigned char led = 0; led != LED_COUNT; led++)
+        {
+            levels[led] = (length > LED_MAX_LEVEL) ? LED_MAX_LEVEL : length;
+            length -= levels[led];
+        }
+        LED_display_value((unsigned char)value);
+        match = check_levels(levels) && match;
+    }
+    sim_check(match, "bar graph rounding of all 256 values");
+
+    // RC0-RC3 are left alone, including when the display is stopped
+    LED_display_stop();
+    sim_run(FRAME_CYCLES);
+    sim_check((LATC & 0b11110000) == 0, "LEDs off when stopped");
+    match = true;
+    for(unsigned long i = first; i != sim_pin_changes; i++)
+    {
+        if(sim_pin_log[i].port == 'C')
+        {
+            match = match && (sim_pin_log[i].value & 0b00001111) == LOW_BITS;
+        }
+    }
+    sim_check(match && sim_pin_changes > first, "RC0-RC3 never changed");
+
+    return (sim_failures != 0);
+}
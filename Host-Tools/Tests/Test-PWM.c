@@ -0,0 +1,88 @@
+/*==============================================================================
+ Test:      Test-PWM
+ Date:      October 17, 2026
+
+ Host simulator tests of PWM_follow(): the PWM frequency set by PWM_start()
+ is kept, samples are timed by whole PWM periods, and the duty cycle follows
+ the full 10-bit ADC result.
+==============================================================================*/
+
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+#include    <stddef.h>
+
+#include    "UBMP4.h"
+#include    "PWM.h"
+
+static void isr(void)
+{
+    PWM_isr();
+    ADC_isr();
+}
+
+// Return the PWM1 duty cycle register
+static unsigned int pwm1_duty(void)
+{
+    return (((unsigned int)PWM1DCH << 2) | (PWM1DCL >> 6));
+}
+
+int main(void)
+{
+    unsigned int rate;
+    unsigned int samples = 0;
+    unsigned int levels = 0;
+    unsigned int duty;
+    unsigned int previous = 0;
+    unsigned long start;
+    bool increasing = true;
+
+    sim_reset();
+    sim_set_isr(isr);
+    OSC_config();
+    UBMP4_config();
+    ADC_config();
+
+    // 20 kHz PWM sampled every 16 periods
+    sim_check(PWM_start(20000) == 20000 && PR2 == 149, "20 kHz PWM");
+    sim_check(PWM_follow(PWM1, ANQ1, 0, NULL) == 0, "rate of 0 rejected");
+    rate = PWM_follow(PWM1, ANQ1, 1000, NULL);
+    sim_check(rate == 1250, "1000 samples/s rounded to 16 PWM periods (1250/s)");
+    sim_check(PR2 == 149 && PWM_frequency() == 20000, "PWM frequency kept");
+    sim_adc_set(ANQ1 >> 2, 512);
+    start = sim_cycle;
+    while(sim_cycle - start < 1200000)
+    {
+        sim_run(100);
+        while(ADC_samples_available() != 0)
+        {
+            ADC_get_sample();
+            samples ++;
+        }
+    }
+    sim_check(samples >= 124 && samples <= 126, "125 samples in 100ms");
+    sim_check(pwm1_duty() == 300, "half scale input gives a 50% duty cycle");
+    sim_adc_set(ANQ1 >> 2, 1023);
+    sim_run(12000);
+    sim_check(pwm1_duty() == 600, "full scale input is always on");
+    ADC_stop_sampling();
+
+    // 46875 Hz PWM (1024 steps) sampled as fast as ADC_isr() allows
+    sim_check(PWM_start(46875) == 46875, "46875 Hz PWM");
+    sim_check(PWM_follow(PWM1, ANQ1, 50000, NULL) == 15625, "fastest rate is every 3 periods");
+    for(unsigned int input = 0; input != 1024; input++)
+    {
+        sim_adc_set(ANQ1 >> 2, input);
+        sim_run(3 * 256 * 2);   // Two sample periods
+        ADC_get_sample();
+        duty = pwm1_duty();
+        levels += (input == 0 || duty != previous);
+        increasing = increasing && duty >= previous;
+        previous = duty;
+    }
+    ADC_stop_sampling();
+    sim_check(increasing && previous == 1023, "duty cycle rises to full scale");
+    sim_check(levels > 1000, "10-bit ADC resolution reaches the duty cycle");
+
+    return (sim_failures != 0);
+}
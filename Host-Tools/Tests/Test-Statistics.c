@@ -0,0 +1,106 @@
+/*==============================================================================
+ Test:      Test-Statistics
+ Date:      October 17, 2026
+
+ Host simulator tests of the streaming statistics: out of range and
+ unconfigured channels are rejected, a window's summary is correct, and
+ stats_send() queues the whole summary line on the interrupt-driven H1
+ output while timed ADC samples keep being collected.
+==============================================================================*/
+
+#include    <string.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Simple-Serial.h"
+#include    "Statistics.h"
+
+#define BIT_CYCLES  ((double)_XTAL_FREQ / 4 / H1_BAUD)
+
+static void isr(void)
+{
+    H1_serial_isr();
+    ADC_isr();
+}
+
+int main(void)
+{
+    stats_summary_t summary;
+    unsigned char line[64];
+    unsigned int bytes;
+    unsigned long start;
+    double edgeError;
+    bool complete = false;
+
+    sim_reset();
+    sim_set_isr(isr);
+    OSC_config();
+    UBMP4_config();
+    ADC_config();
+    H1_serial_start();
+
+    // Channel and window checks
+    sim_check(!stats_config(STATS_CHANNELS, 100), "out of range channel rejected");
+    sim_check(!stats_config(0, 1) && !stats_config(0, STATS_MAX_WINDOW + 1), "out of range window rejected");
+    sim_check(!stats_sample(1, 100) && !stats_sample(1, 100), "samples for an unconfigured channel ignored");
+    sim_check(!stats_sample(STATS_CHANNELS, 100), "samples for an out of range channel ignored");
+    sim_check(!stats_summary(1, &summary) && !stats_summary(STATS_CHANNELS, &summary), "no summary for an unconfigured channel");
+    start = sim_cycle;
+    sim_check(!stats_send(1) && !stats_send(STATS_CHANNELS), "no summary sent for an unconfigured channel");
+    sim_run(2 * 10 * BIT_CYCLES);
+    sim_check(sim_serial_decode('C', 0, BIT_CYCLES, start, line, sizeof(line), &edgeError) == 0, "nothing sent for an unconfigured channel");
+
+    // A window of 4 samples
+    sim_check(stats_config(0, 4), "channel 0 set to 4 samples");
+    stats_sample(0, 10);
+    stats_sample(0, 12);
+    stats_sample(0, 14);
+    sim_check(stats_sample(0, 16), "window completes on the 4th sample");
+    sim_check(stats_summary(0, &summary), "summary ready");
+    sim_check(summary.count == 4 && summary.minimum == 10 && summary.maximum == 16, "count and range");
+    sim_check(summary.mean == 13 * 16 && summary.variance == 5 * 16, "mean and variance");
+
+    // Send a summary while sampling at 1000 samples/s
+    sim_check(stats_config(0, 1000), "channel 0 set to 1000 samples");
+    ADC_overruns = 0;
+    ADC_start_timed_sampling(ANQ1, 1000);
+    sim_adc_set(ANQ1 >> 2, 512);
+    start = sim_cycle;
+    while(!complete && sim_cycle - start < 15000000)
+    {
+        sim_run(16384);         // One scheduler tick
+        while(ADC_samples_available() != 0)
+        {
+            if(stats_sample(0, ADC_get_sample() >> 6))
+            {
+                start = sim_cycle;
+                sim_check(stats_send(0), "summary started");
+                sim_check(!stats_flush(), "line longer than the H1 FIFO");
+                sim_check(!stats_send(0), "next line waits for this one");
+                complete = true;
+            }
+        }
+    }
+    sim_check(complete, "1000 sample window completed");
+    
+    // Keep sampling, queueing the rest of the line each tick
+    for(unsigned int tick = 0; tick != 40; tick++)
+    {
+        sim_run(16384);
+        stats_flush();
+        while(ADC_samples_available() != 0)
+        {
+            stats_sample(0, ADC_get_sample() >> 6);
+        }
+    }
+    sim_check(stats_flush(), "whole line queued");
+    ADC_stop_sampling();
+    sim_check(ADC_overruns == 0, "no samples lost while sending");
+    bytes = sim_serial_decode('C', 0, BIT_CYCLES, start, line, sizeof(line) - 1, &edgeError);
+    line[bytes] = 0;
+    sim_check(bytes == 39 && strcmp((char *)line, "S0 N01000 L00512 H00512 M08192 V00000\r\n") == 0, "whole summary line sent");
+
+    return (sim_failures != 0);
+}
@@ -0,0 +1,122 @@
+/*==============================================================================
+ Test:      Test-Threshold
+ Date:      October 17, 2026
+
+ Host simulator tests of the threshold detector: the rising and falling
+ levels and the hysteresis gap between them, the debounce count, the event
+ times and order, event queue overflow, and the event lines sent out of H1.
+==============================================================================*/
+
+#include    <string.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Simple-Serial.h"
+#include    "Threshold.h"
+
+#define BIT_CYCLES  ((double)_XTAL_FREQ / 4 / H1_BAUD)
+
+// Update a channel with count copies of a sample, and return the number of
+// changes of state
+static unsigned char update_samples(unsigned char channel, unsigned int sample, unsigned char count)
+{
+    unsigned char changes = 0;
+
+    while(count-- != 0)
+    {
+        if(threshold_update(channel, sample) != THRESHOLD_NONE)
+        {
+            changes ++;
+        }
+    }
+    return (changes);
+}
+
+int main(void)
+{
+    threshold_event_t event;
+    unsigned char line[32];
+    unsigned char direction = THRESHOLD_FALLING;
+    unsigned char bytes;
+    unsigned char events;
+    unsigned long start;
+    double edgeError;
+    bool ordered = true;
+
+    sim_reset();
+    OSC_config();
+    UBMP4_config();
+    H1_serial_config();
+
+    // The first sample sets the starting state without an event
+    threshold_config(0, 140, 120, 3);
+    sim_check(threshold_update(0, 100) == THRESHOLD_NONE && !threshold_state(0), "first sample starts low");
+    threshold_config(1, 140, 120, 3);
+    sim_check(threshold_update(1, 150) == THRESHOLD_NONE && threshold_state(1), "first sample starts high");
+    sim_check(!threshold_get_event(&event), "no events queued at the start");
+
+    // Rising: samples below the rising level, or a run of samples at it that
+    // is broken by one back in the hysteresis gap, don't change the state
+    sim_check(update_samples(0, 139, 5) == 0, "no change below the rising level");
+    sim_check(update_samples(0, 140, 2) == 0, "no change before the debounce count");
+    sim_check(update_samples(0, 130, 1) == 0, "sample in the gap restarts the count");
+    sim_check(update_samples(0, 140, 2) == 0, "debounce count started over");
+    sim_check(threshold_update(0, 140) == THRESHOLD_RISING && threshold_state(0), "rising after 3 samples");   // Sample 11
+
+    // Noise inside the gap doesn't change a high channel
+    sim_check(update_samples(0, 121, 3) == 0 && update_samples(0, 139, 2) == 0, "no change in the gap");
+
+    // Falling
+    sim_check(update_samples(0, 120, 2) == 0, "no change before the debounce count");
+    sim_check(update_samples(0, 125, 1) == 0, "sample in the gap restarts the count");
+    sim_check(update_samples(0, 120, 2) == 0, "debounce count started over");
+    sim_check(threshold_update(0, 100) == THRESHOLD_FALLING && !threshold_state(0), "falling after 3 samples");   // Sample 22
+    sim_check(update_samples(0, 130, 5) == 0, "no change in the gap when low");
+
+    // Events are queued in order with each channel's sample count
+    sim_check(threshold_get_event(&event) && event.channel == 0 && event.direction == THRESHOLD_RISING
+            && event.time == 11, "rising event");
+    sim_check(threshold_get_event(&event) && event.channel == 0 && event.direction == THRESHOLD_FALLING
+            && event.time == 22, "falling event");
+    sim_check(!threshold_get_event(&event), "queue empty");
+
+    // A debounce count of 0 works like 1
+    threshold_config(2, 600, 500, 0);
+    threshold_update(2, 0);
+    sim_check(threshold_update(2, 600) == THRESHOLD_RISING, "debounce of 0 changes on the first sample");
+    sim_check(threshold_update(2, 500) == THRESHOLD_FALLING, "and on the first sample back");
+    threshold_get_event(&event);
+    threshold_get_event(&event);
+
+    // Changes are still reported, but not queued, once the queue is full
+    threshold_overflows = 0;
+    threshold_config(3, 600, 500, 1);
+    threshold_update(3, 0);
+    for(unsigned char i = 0; i != THRESHOLD_EVENTS + 2; i++)
+    {
+        sim_check(threshold_update(3, (i & 1) ? 0 : 1023) != THRESHOLD_NONE, "change reported");
+    }
+    sim_check(threshold_overflows == 2, "2 events lost when the queue is full");
+    for(events = 0; threshold_get_event(&event); events++)
+    {
+        ordered = ordered && event.channel == 3 && event.time == (unsigned int)events + 1
+                && event.direction != direction;
+        direction = event.direction;
+    }
+    sim_check(events == THRESHOLD_EVENTS && ordered, "the oldest events are kept in order");
+    sim_check(threshold_update(3, 1023) == THRESHOLD_RISING && threshold_get_event(&event), "queue usable after emptying");
+
+    // Send an event line out of H1
+    threshold_update(3, 0);
+    start = sim_cycle;
+    threshold_send_events();
+    sim_run(2 * 10 * BIT_CYCLES);
+    bytes = sim_serial_decode('C', 0, BIT_CYCLES, start, line, sizeof(line) - 1, &edgeError);
+    line[bytes] = 0;
+    sim_check(strcmp((char *)line, "T3 F 00012\r\n") == 0, "event line sent");
+    sim_check(!threshold_get_event(&event), "sent events removed from the queue");
+
+    return (sim_failures != 0);
+}
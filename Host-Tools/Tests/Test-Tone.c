@@ -0,0 +1,73 @@
+/*==============================================================================
+ Test:      Test-Tone
+ Date:      October 17, 2026
+
+ Host simulator tests of tone_isr() sharing TMR1 with the H1 serial output:
+ the tone handler leaves TMR1 interrupts alone until tone_start() is called,
+ and again after tone_stop().
+==============================================================================*/
+
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "Simple-Serial.h"
+#include    "Tone.h"
+
+static void isr(void)
+{
+    tone_isr();
+    H1_serial_isr();
+}
+
+// Send a few bytes and return true if they all left the FIFO in time
+static bool send_bytes(void)
+{
+    unsigned long start = sim_cycle;
+    
+    for(unsigned char i = 0; i != 4; i++)
+    {
+        H1_serial_send((unsigned char)(i + 0x30));
+    }
+    while((H1_serial_pending() != 0 || TMR1IE) && sim_cycle - start < 200000)
+    {
+        sim_run(100);
+    }
+    return (H1_serial_pending() == 0 && !TMR1IE && H1OUT == 1);
+}
+
+int main(void)
+{
+    unsigned char toggles = 0;
+    unsigned char beeper;
+
+    sim_reset();
+    sim_set_isr(isr);
+    OSC_config();
+    UBMP4_config();
+    H1_serial_start();
+
+    // The tone handler is in the ISR but hasn't been started
+    sim_check(send_bytes(), "H1 output works before tone_start()");
+    sim_check(BEEPER == 0, "beeper stays off before tone_start()");
+
+    // Playing a note toggles the beeper
+    tone_start();
+    tone_set_note(TONE_NOTES - 1);   // A6, toggling every 3409 cycles
+    beeper = BEEPER;
+    for(unsigned int i = 0; i != 1000; i++)
+    {
+        sim_run(100);
+        toggles += (BEEPER != beeper);
+        beeper = BEEPER;
+    }
+    sim_check(toggles > 2, "beeper toggles while playing");
+
+    // After stopping, H1 has TMR1 to itself again
+    tone_stop();
+    sim_check(send_bytes(), "H1 output works after tone_stop()");
+    sim_check(BEEPER == 0, "beeper off after tone_stop()");
+
+    return (sim_failures != 0);
+}
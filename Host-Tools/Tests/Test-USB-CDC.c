@@ -0,0 +1,298 @@
+/*==============================================================================
+ Test:      Test-USB-CDC
+ Date:      October 17, 2026
+
+ Host simulator tests of the USB-CDC device. The test acts as the computer
+ and the SIE: it hands packets to the device by writing the endpoint buffers
+ and buffer descriptors (BDs) owned by the SIE, clears UOWN and queues the
+ transaction's USTAT value, as the SIE does, and takes packets the device
+ has given to the SIE. Enumeration runs the control requests a computer
+ sends, then timed ADC samples are streamed through the bulk IN endpoint
+ and checked for gaps.
+==============================================================================*/
+
+// CFLAGS: -DUSB_CDC -Wno-pointer-to-int-cast
+
+#include    <stdio.h>
+#include    <string.h>
+#include    <xc.h>
+#include    <stdint.h>
+#include    <stdbool.h>
+
+#include    "UBMP4.h"
+#include    "USB-CDC.h"
+
+// Buffer descriptor table and buffers in USB-CDC.c
+typedef struct
+{
+    unsigned char STAT;
+    unsigned char CNT;
+    unsigned char ADRL;
+    unsigned char ADRH;
+} bd_t;
+
+extern bd_t usbBD[10];
+extern unsigned char usbEP0Out[USB_EP0_SIZE];
+extern unsigned char usbEP0In[USB_EP0_SIZE];
+extern unsigned char usbEP2Out[2][USB_CDC_OUT_SIZE];
+extern unsigned char usbEP2In[2][USB_CDC_IN_SIZE];
+extern unsigned char cdcLineCoding[7];
+extern bool cdcDTR;
+
+#define BD_EP0_OUT  0
+#define BD_EP0_IN   1
+#define BD_EP2_OUT  6
+#define BD_EP2_IN   8
+
+#define UOWN        0b10000000
+#define DTS         0b01000000
+#define BSTALL      0b00000100
+
+#define PID_OUT     0x1
+#define PID_IN      0x9
+#define PID_SETUP   0xD
+
+// USTAT values (endpoint, direction and ping-pong buffer)
+#define USTAT_EP0_OUT   0x00
+#define USTAT_EP0_IN    0x04
+#define USTAT_EP2_OUT   0x10
+#define USTAT_EP2_IN    0x14
+
+#define FRAME_CYCLES    12000   // 1ms USB frame in instruction cycles
+
+static bool stalled;            // Endpoint 0 stalled the last request
+
+static void isr(void)
+{
+    USB_isr();
+    ADC_isr();
+}
+
+static unsigned int count;
+
+// ADC input, the next number of a 10-bit count for each conversion
+static unsigned int next_count(unsigned char channel)
+{
+    (void)channel;
+    return (count++ & 0x3FF);
+}
+
+// Return true if a BD points at a buffer (the host build stores the low 16
+// bits of the buffer's host address)
+static bool bd_points_at(unsigned char bd, unsigned char *buffer)
+{
+    return ((((unsigned int)usbBD[bd].ADRH << 8) | usbBD[bd].ADRL) == ((uintptr_t)buffer & 0xFFFF));
+}
+
+// Complete a transaction: the SIE writes the PID and clears UOWN, then
+// queues USTAT and the device handles it in USB_isr()
+static void transaction(unsigned char bd, unsigned char pid, bool data1, unsigned char ustat)
+{
+    usbBD[bd].STAT = (unsigned char)((pid << 2) | ((data1) ? DTS : 0));
+    sim_usb_transaction(ustat);
+    sim_run(2000);
+}
+
+// Send a SETUP packet to endpoint 0
+static bool setup(unsigned char type, unsigned char request, unsigned int value,
+        unsigned int index, unsigned int length)
+{
+    unsigned char packet[8] = {type, request, (unsigned char)value, (unsigned char)(value >> 8),
+            (unsigned char)index, (unsigned char)(index >> 8), (unsigned char)length, (unsigned char)(length >> 8)};
+
+    if(!(usbBD[BD_EP0_OUT].STAT & UOWN) || !bd_points_at(BD_EP0_OUT, usbEP0Out))
+    {
+        return (false);
+    }
+    memcpy(usbEP0Out, packet, 8);
+    usbBD[BD_EP0_OUT].CNT = 8;
+    PKTDIS = 1;                 // The SIE disables packets after SETUP
+    transaction(BD_EP0_OUT, PID_SETUP, false, USTAT_EP0_OUT);
+    stalled = (usbBD[BD_EP0_IN].STAT & (UOWN | BSTALL)) == (UOWN | BSTALL);
+    return (PKTDIS == 0);
+}
+
+// Take an IN packet from endpoint 0. Returns its length, or -1 if there is
+// none or its data toggle is wrong.
+static int ep0_in(unsigned char *data, bool data1)
+{
+    unsigned char stat = usbBD[BD_EP0_IN].STAT;
+    unsigned char length = usbBD[BD_EP0_IN].CNT;
+
+    if(!(stat & UOWN) || (stat & BSTALL) || ((stat & DTS) != 0) != data1
+            || length > USB_EP0_SIZE || !bd_points_at(BD_EP0_IN, usbEP0In))
+    {
+        return (-1);
+    }
+    memcpy(data, usbEP0In, length);
+    transaction(BD_EP0_IN, PID_IN, data1, USTAT_EP0_IN);
+    return (length);
+}
+
+// Send an OUT packet to endpoint 0
+static bool ep0_out(const unsigned char *data, unsigned char length, bool data1)
+{
+    if(!(usbBD[BD_EP0_OUT].STAT & UOWN) || length > usbBD[BD_EP0_OUT].CNT)
+    {
+        return (false);
+    }
+    memcpy(usbEP0Out, data, length);
+    usbBD[BD_EP0_OUT].CNT = length;
+    transaction(BD_EP0_OUT, PID_OUT, data1, USTAT_EP0_OUT);
+    return (true);
+}
+
+// Run a control read: SETUP, IN data packets until a short packet or length
+// bytes, then the zero length OUT status packet. Returns the bytes read, or
+// -1 if the transfer failed.
+static int control_read(unsigned char type, unsigned char request, unsigned int value,
+        unsigned int length, unsigned char *data)
+{
+    int received = 0;
+    int packet;
+    bool data1 = true;
+
+    if(!setup(type, request, value, 0, length) || stalled)
+    {
+        return (-1);
+    }
+    do
+    {
+        packet = ep0_in(data + received, data1);
+        if(packet < 0)
+        {
+            return (-1);
+        }
+        received += packet;
+        data1 = !data1;
+    } while(packet == USB_EP0_SIZE && received < (int)length);
+    return ((ep0_out(data, 0, true)) ? received : -1);
+}
+
+// Run a control write with an optional OUT data stage, then take the zero
+// length IN status packet
+static bool control_write(unsigned char type, unsigned char request, unsigned int value,
+        const unsigned char *data, unsigned char length)
+{
+    unsigned char status[USB_EP0_SIZE];
+
+    if(!setup(type, request, value, 0, length) || stalled)
+    {
+        return (false);
+    }
+    if(length != 0 && !ep0_out(data, length, true))
+    {
+        return (false);
+    }
+    return (ep0_in(status, true) == 0);
+}
+
+// Take every bulk IN packet the device has ready, in ping-pong order, and
+// check its data toggle. Returns the bytes added to data.
+static unsigned int ep2_in(unsigned char *data, unsigned char *odd, unsigned int *toggleErrors)
+{
+    unsigned int received = 0;
+
+    while(usbBD[BD_EP2_IN + *odd].STAT & UOWN)
+    {
+        unsigned char bd = BD_EP2_IN + *odd;
+        bool data1 = usbBD[bd].STAT & DTS;
+
+        *toggleErrors += (data1 != (*odd == 1)) || !bd_points_at(bd, usbEP2In[*odd]);
+        memcpy(data + received, usbEP2In[*odd], usbBD[bd].CNT);
+        received += usbBD[bd].CNT;
+        transaction(bd, PID_IN, data1, (unsigned char)(USTAT_EP2_IN | (*odd << 1)));
+        *odd ^= 1;
+    }
+    return (received);
+}
+
+int main(void)
+{
+    unsigned char data[256];
+    static unsigned char stream[4096];
+    unsigned char coding[7] = {0x00, 0xC2, 0x01, 0x00, 0, 0, 8};   // 115200,8,N,1
+    unsigned char odd = 0;
+    unsigned int received = 0;
+    unsigned int toggleErrors = 0;
+    unsigned int gaps = 0;
+    unsigned long start;
+
+    sim_reset();
+    sim_set_isr(isr);
+    OSC_config();
+    UBMP4_config();
+    ADC_config();
+    sim_adc_source(next_count);
+
+    // Attach and bus reset
+    USB_CDC_start();
+    sim_check(USBEN && USBIE && GIE, "USB module and interrupt enabled");
+    URSTIF = 1;
+    USBIF = 1;
+    sim_run(2000);
+    sim_check(URSTIF == 0 && UADDR == 0, "bus reset handled");
+    sim_check((usbBD[BD_EP0_OUT].STAT & UOWN) && usbBD[BD_EP0_OUT].CNT == USB_EP0_SIZE,
+            "endpoint 0 ready for SETUP");
+
+    // Enumeration
+    sim_check(control_read(0x80, 6, 0x0100, 64, data) == 18 && data[0] == 18 && data[1] == 1
+            && data[7] == USB_EP0_SIZE && data[8] == (USB_VID & 0xFF) && data[10] == (USB_PID & 0xFF),
+            "device descriptor");
+    sim_check(control_write(0x00, 5, 7, NULL, 0), "SET_ADDRESS");
+    sim_check(UADDR == 7, "address set after the status stage");
+    sim_check(control_read(0x80, 6, 0x0200, 9, data) == 9 && data[1] == 2 && data[2] == 67,
+            "configuration descriptor header");
+    sim_check(control_read(0x80, 6, 0x0200, 255, data) == 67 && data[9 + 1] == 4 && data[66] == 0,
+            "full configuration descriptor");
+    sim_check(control_read(0x80, 6, 0x0200, 64, data) == 64, "reply cut to the requested length");
+    sim_check(control_read(0x80, 6, 0x0302, 255, data) == 40 && data[2] == 'U', "product string");
+    sim_check(control_read(0x80, 6, 0x0600, 10, data) < 0 && stalled, "unknown descriptor stalls");
+    sim_check(control_read(0x80, 6, 0x0100, 18, data) == 18, "SETUP after a stall");
+    sim_check(!USB_CDC_ready() && !USB_CDC_write('A'), "no data before configuration");
+    sim_check(control_write(0x00, 9, 1, NULL, 0), "SET_CONFIGURATION");
+    sim_check(USB_CDC_ready(), "configured");
+    sim_check((usbBD[BD_EP2_OUT].STAT & UOWN) && (usbBD[BD_EP2_OUT + 1].STAT & UOWN)
+            && !(usbBD[BD_EP2_IN].STAT & UOWN) && !(usbBD[BD_EP2_IN + 1].STAT & UOWN),
+            "bulk OUT buffers armed, IN buffers empty");
+    sim_check(control_read(0x80, 8, 0, 1, data) == 1 && data[0] == 1, "GET_CONFIGURATION");
+
+    // CDC class requests
+    sim_check(control_write(0x21, 0x20, 0, coding, 7), "SET_LINE_CODING");
+    sim_check(memcmp(cdcLineCoding, coding, 7) == 0, "line coding stored");
+    sim_check(control_read(0xA1, 0x21, 0, 7, data) == 7 && memcmp(data, coding, 7) == 0,
+            "GET_LINE_CODING");
+    sim_check(control_write(0x21, 0x22, 0x0001, NULL, 0) && cdcDTR, "SET_CONTROL_LINE_STATE");
+
+    // Received bulk data is discarded and the OUT buffer re-armed
+    usbBD[BD_EP2_OUT].CNT = 5;
+    transaction(BD_EP2_OUT, PID_OUT, false, USTAT_EP2_OUT);
+    sim_check((usbBD[BD_EP2_OUT].STAT & UOWN) && usbBD[BD_EP2_OUT].CNT == USB_CDC_OUT_SIZE,
+            "bulk OUT buffer re-armed");
+
+    // Stream 5000 samples/s for 200ms, flushing every 1ms like usb_task()
+    // and taking IN packets once per frame
+    ADC_start_timed_sampling(ANQ1, 5000);
+    start = sim_cycle;
+    while(sim_cycle - start < 200UL * FRAME_CYCLES)
+    {
+        sim_run(FRAME_CYCLES);
+        USB_CDC_send_samples();
+        USB_CDC_flush();
+        received += ep2_in(stream + received, &odd, &toggleErrors);
+    }
+    ADC_stop_sampling();
+    for(unsigned int i = 2; i + 1 < received; i += 2)
+    {
+        unsigned int sample = stream[i] | ((unsigned int)stream[i + 1] << 8);
+        unsigned int previous = stream[i - 2] | ((unsigned int)stream[i - 1] << 8);
+
+        gaps += (sample != ((previous + 1) & 0x3FF));
+    }
+    printf("Streamed %u bytes (%u samples)\n", received, received / 2);
+    sim_check(received >= 2 * 990 && received <= 2 * 1010, "1000 samples in 200ms");
+    sim_check(gaps == 0 && ADC_overruns == 0, "no samples lost");
+    sim_check(toggleErrors == 0, "even buffers sent as DATA0, odd as DATA1");
+
+    return (sim_failures != 0);
+}
@@ -0,0 +1,186 @@
+/*==============================================================================
+ Library:   ADC-Filter
+ Date:      October 17, 2026
+ 
+ Fixed-point digital filters for ADC samples.
+ 
+ The moving average keeps a running sum of the samples in its window, adding
+ each new sample and subtracting the one leaving the window, so its cost does
+ not depend on the window size. Since the window is a power of 2, the average
+ is the sum shifted right.
+ 
+ The exponential moving average (EMA) stores its value shifted left by the
+ filter's shift, so that fractions of a sample aren't lost. Each update adds
+ the new sample and subtracts 1/2^shift of the stored value, which moves the
+ output 1/2^shift of the way towards the new sample.
+ 
+ The median filters reject single-sample spikes (3 taps) or pairs of spikes
+ (5 taps) by returning the middle value of the latest samples.
+ 
+ Cost of filter_sample() in host instructions (x86-64, built without
+ optimization like the project) for 1024 noisy samples, measured by the host
+ benchmark (make -C Host-Tools bench, Bench-Filter.c):
+ 
+   Filter        Minimum  Average  Maximum
+   None               73     73.0       73
+   Average 4         106    106.0      106
+   Average 16        106    106.0      106
+   EMA 1/4           103    103.0      103
+   EMA 1/64          103    103.0      103
+   Median 3          100    106.2      111
+   Median 5          128    145.0      162
+ 
+ The averages cost the same for any window or weight, and only the medians
+ depend on the order of the samples. Host instructions are not PIC
+ instruction cycles - measure those on the device with the PROBE_FILTER
+ profiling probes (see Profile.h).
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "ADC-Filter.h"      // Include filter functions
+#include    "Profile.h"         // Include profiling probes (if enabled)
+
+#if (FILTER_HISTORY & (FILTER_HISTORY - 1)) != 0 || FILTER_HISTORY > 64 || FILTER_HISTORY < 8
+#error FILTER_HISTORY must be a power of 2 from 8 to 64
+#endif
+
+// Filter state
+unsigned int filterHistory[FILTER_CHANNELS][FILTER_HISTORY];    // Latest samples
+unsigned int filterState[FILTER_CHANNELS];      // Running sum or shifted EMA
+unsigned char filterType[FILTER_CHANNELS];      // Filter type
+unsigned char filterShift[FILTER_CHANNELS];     // Window or weight shift
+unsigned char filterNext[FILTER_CHANNELS];      // Next history location
+bool filterEmpty[FILTER_CHANNELS];              // True until the first sample
+
+#define SWAP(a, b) {unsigned int temp = a; a = b; b = temp;}
+
+// Set the type and shift of a filter and reset it
+void filter_config(unsigned char filter, unsigned char type, unsigned char shift)
+{
+    if(type == FILTER_AVERAGE && (1 << shift) > FILTER_HISTORY)
+    {
+        shift = 0;              // Window would be larger than the history
+        while((2 << shift) <= FILTER_HISTORY)
+        {
+            shift ++;
+        }
+    }
+    if(type == FILTER_EMA && shift > 6)
+    {
+        shift = 6;              // Limit the EMA to 1023 << 6 so it fits 16 bits
+    }
+    filterType[filter] = type;
+    filterShift[filter] = shift;
+    filter_reset(filter);
+}
+
+// Clear a filter's history
+void filter_reset(unsigned char filter)
+{
+    filterEmpty[filter] = true;
+}
+
+// Return the median of 3 values
+static unsigned int median3(unsigned int a, unsigned int b, unsigned int c)
+{
+    if(b < a)
+    {
+        SWAP(a, b);
+    }
+    if(c < b)
+    {
+        b = (c < a) ? a : c;
+    }
+    return (b);
+}
+
+// Return the median of 5 values using 6 comparisons. The smallest of a and c
+// (after ordering the pairs a, b and c, d) can't be the median, so it is
+// replaced by e and the search is repeated on the remaining values.
+static unsigned int median5(unsigned int a, unsigned int b, unsigned int c, unsigned int d, unsigned int e)
+{
+    if(b < a)
+    {
+        SWAP(a, b);
+    }
+    if(d < c)
+    {
+        SWAP(c, d);
+    }
+    if(c < a)
+    {
+        SWAP(b, d);
+        c = a;
+    }
+    a = e;
+    if(b < a)
+    {
+        SWAP(a, b);
+    }
+    if(a < c)
+    {
+        SWAP(b, d);
+        a = c;
+    }
+    return ((d < a) ? d : a);
+}
+
+// Add a new sample to a filter and return the filtered value
+unsigned int filter_sample(unsigned char filter, unsigned int sample)
+{
+    unsigned char next = filterNext[filter];
+    unsigned char shift = filterShift[filter];
+    unsigned int *history = filterHistory[filter];
+    unsigned int result;
+    
+    // Fill the history and filter state with the first sample
+    if(filterEmpty[filter])
+    {
+        for(unsigned char i = 0; i != FILTER_HISTORY; i++)
+        {
+            history[i] = sample;
+        }
+        filterState[filter] = sample << shift;
+        filterEmpty[filter] = false;
+    }
+    
+    switch(filterType[filter])
+    {
+        case FILTER_AVERAGE:
+            PROFILE_ENTER(PROBE_FILTER_AVERAGE);
+            // Sample leaving the window is 2^shift locations behind next
+            filterState[filter] += sample - history[(unsigned char)(next - (1 << shift)) & (FILTER_HISTORY - 1)];
+            result = filterState[filter] >> shift;
+            PROFILE_EXIT(PROBE_FILTER_AVERAGE);
+            break;
+        case FILTER_EMA:
+            PROFILE_ENTER(PROBE_FILTER_EMA);
+            filterState[filter] += sample - (filterState[filter] >> shift);
+            result = filterState[filter] >> shift;
+            PROFILE_EXIT(PROBE_FILTER_EMA);
+            break;
+        case FILTER_MEDIAN3:
+            PROFILE_ENTER(PROBE_FILTER_MEDIAN);
+            result = median3(sample, history[(next - 1) & (FILTER_HISTORY - 1)],
+                    history[(next - 2) & (FILTER_HISTORY - 1)]);
+            PROFILE_EXIT(PROBE_FILTER_MEDIAN);
+            break;
+        case FILTER_MEDIAN5:
+            PROFILE_ENTER(PROBE_FILTER_MEDIAN);
+            result = median5(sample, history[(next - 1) & (FILTER_HISTORY - 1)],
+                    history[(next - 2) & (FILTER_HISTORY - 1)],
+                    history[(next - 3) & (FILTER_HISTORY - 1)],
+                    history[(next - 4) & (FILTER_HISTORY - 1)]);
+            PROFILE_EXIT(PROBE_FILTER_MEDIAN);
+            break;
+        default:
+            result = sample;
+    }
+    
+    history[next] = sample;
+    filterNext[filter] = (next + 1) & (FILTER_HISTORY - 1);
+    return (result);
+}
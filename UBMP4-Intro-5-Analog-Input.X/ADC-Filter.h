@@ -0,0 +1,53 @@
+/*==============================================================================
+ File:  ADC-Filter.h
+ Date:  October 17, 2026
+ 
+ Fixed-point digital filter function prototypes
+ 
+ Function prototypes for filtering 8-bit or 10-bit ADC samples on the UBMP4
+ before they are displayed or sent. Each of the FILTER_CHANNELS filters can be
+ set to a different filter type, so each ADC channel in use can have its own
+ filter. All of the filters use integer additions, comparisons and shifts only.
+==============================================================================*/
+
+// Number of independent filters, and the longest moving average window
+#define FILTER_CHANNELS 4
+#define FILTER_HISTORY  16          // Must be a power of 2, no larger than 64
+
+// Filter types
+#define FILTER_NONE     0           // Pass samples through unchanged
+#define FILTER_AVERAGE  1           // Moving average of 2^shift samples
+#define FILTER_EMA      2           // Exponential moving average, alpha = 1/2^shift
+#define FILTER_MEDIAN3  3           // Median of the last 3 samples
+#define FILTER_MEDIAN5  4           // Median of the last 5 samples
+
+/**
+ * Function: void filter_config(unsigned char filter, unsigned char type,
+ *                              unsigned char shift)
+ * 
+ * Set the type of one of the filters (0 to FILTER_CHANNELS - 1) and reset it.
+ * For FILTER_AVERAGE, shift sets the window to 2^shift samples, up to
+ * FILTER_HISTORY. For FILTER_EMA, each new sample is given a weight of
+ * 1/2^shift (shift from 1 to 6). Shift is ignored by the other filter types.
+ * 
+ * Example usage: filter_config(0, FILTER_AVERAGE, 3);  // 8 sample average
+ */
+void filter_config(unsigned char, unsigned char, unsigned char);
+
+/**
+ * Function: void filter_reset(unsigned char filter)
+ * 
+ * Clear a filter's history. The next sample will fill the history so that
+ * the filter starts without a ramp up from zero.
+ */
+void filter_reset(unsigned char);
+
+/**
+ * Function: unsigned int filter_sample(unsigned char filter,
+ *                                      unsigned int sample)
+ * 
+ * Add a new sample (up to 10 bits) to a filter and return the filtered value.
+ * 
+ * Example usage: level = filter_sample(0, ADC_read_10bit());
+ */
+unsigned int filter_sample(unsigned char, unsigned int);
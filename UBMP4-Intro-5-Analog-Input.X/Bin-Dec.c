@@ -0,0 +1,87 @@
+/*==============================================================================
+ Library:   Bin-Dec
+ Date:      October 17, 2026
+ 
+ Binary to decimal ASCII conversion functions using the shift-and-add-3
+ (double dabble) algorithm. The binary value is shifted left, one bit at a
+ time, into packed BCD (binary coded decimal) digits. Before each shift, every
+ BCD digit of 5 or more has 3 added to it, so that doubling it carries
+ correctly into the next digit. The digit adjustments are made using logical
+ operations instead of comparisons, so the functions run in the same number
+ of cycles for every value, unlike the repeated subtraction used by
+ bin_to_dec(), which takes longer for larger values.
+ 
+ Cost in host instructions (x86-64, built without optimization like the
+ project), measured by the host benchmark (make -C Host-Tools bench,
+ Bench-Bin-Dec.c) for every 8-bit value and a spread of 16-bit values:
+ 
+   Function          Minimum  Average  Maximum
+   bin_to_dec             27     70.7      117
+   bin8_to_ascii         273    273.0      273
+   bin16_to_ascii        892    892.0      892
+ 
+ So the constant time comes at a price: bin8_to_ascii() costs about 2.3
+ times as much as bin_to_dec() in its worst case, and almost 4 times as
+ much on average. Use it where a conversion must always take the same time
+ (such as in a fixed-rate sample loop), not to save time. Host instructions
+ are not PIC instruction cycles - use the MPLAB X stopwatch to measure those.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "Bin-Dec.h"         // Include binary to decimal functions
+#include    "Profile.h"         // Include profiling probes (if enabled)
+
+// Add 3 to every packed BCD digit of 5 or more. Adding 3 to a digit of 5-9
+// sets its bit 3 without carrying into the next digit, so (bcd + 0x33) & 0x88
+// marks the digits to adjust, and shifting the marks right 2 and 3 bits turns
+// each mark into a 3 (0b11) in the same digit.
+#define BCD_ADJUST(bcd) bcd = bcd + ((((bcd + 0x33) & 0x88) >> 2) | (((bcd + 0x33) & 0x88) >> 3))
+
+// Convert an 8-bit binary number into 3 ASCII decimal digits
+void bin8_to_ascii(unsigned char bin, unsigned char *ascii)
+{
+    unsigned char bcd0 = 0;     // Packed tens and ones digits
+    unsigned char bcd1 = 0;     // Hundreds digit
+    
+    for(unsigned char bits = 8; bits != 0; bits--)
+    {
+        BCD_ADJUST(bcd0);       // Hundreds digit is never more than 2
+        bcd1 = (unsigned char)(bcd1 << 1) | (bcd0 >> 7);
+        bcd0 = (unsigned char)(bcd0 << 1) | (bin >> 7);
+        bin = bin << 1;
+    }
+    ascii[0] = bcd1 + '0';
+    ascii[1] = (bcd0 >> 4) + '0';
+    ascii[2] = (bcd0 & 0x0f) + '0';
+}
+
+// Convert a 16-bit binary number into 5 ASCII decimal digits
+void bin16_to_ascii(unsigned int bin, unsigned char *ascii)
+{
+    unsigned char binH = (unsigned char)(bin >> 8);
+    unsigned char binL = (unsigned char)bin;
+    unsigned char bcd0 = 0;     // Packed tens and ones digits
+    unsigned char bcd1 = 0;     // Packed thousands and hundreds digits
+    unsigned char bcd2 = 0;     // Ten thousands digit
+    
+    PROFILE_ENTER(PROBE_BIN16_TO_ASCII);
+    for(unsigned char bits = 16; bits != 0; bits--)
+    {
+        BCD_ADJUST(bcd0);       // Ten thousands digit is never more than 6,
+        BCD_ADJUST(bcd1);       // and is never doubled after reaching 5
+        bcd2 = (unsigned char)(bcd2 << 1) | (bcd1 >> 7);
+        bcd1 = (unsigned char)(bcd1 << 1) | (bcd0 >> 7);
+        bcd0 = (unsigned char)(bcd0 << 1) | (binH >> 7);
+        binH = (unsigned char)(binH << 1) | (binL >> 7);
+        binL = binL << 1;
+    }
+    ascii[0] = bcd2 + '0';
+    ascii[1] = (bcd1 >> 4) + '0';
+    ascii[2] = (bcd1 & 0x0f) + '0';
+    ascii[3] = (bcd0 >> 4) + '0';
+    ascii[4] = (bcd0 & 0x0f) + '0';
+    PROFILE_EXIT(PROBE_BIN16_TO_ASCII);
+}
@@ -0,0 +1,31 @@
+/*==============================================================================
+ File:  Bin-Dec.h
+ Date:  October 17, 2026
+ 
+ Binary to decimal ASCII conversion function prototypes
+ 
+ Function prototypes for converting 8-bit and 16-bit binary values into fixed-
+ width decimal ASCII digits that can be written directly to a serial output.
+==============================================================================*/
+
+/**
+ * Function: void bin8_to_ascii(unsigned char bin, unsigned char *ascii)
+ * 
+ * Convert an 8-bit binary number into 3 ASCII decimal digits (000-255),
+ * stored in ascii[0] (hundreds) to ascii[2] (ones). Takes the same number of
+ * instruction cycles for every value.
+ * 
+ * Example usage: bin8_to_ascii(rawADC, digits);
+ */
+void bin8_to_ascii(unsigned char, unsigned char *);
+
+/**
+ * Function: void bin16_to_ascii(unsigned int bin, unsigned char *ascii)
+ * 
+ * Convert a 16-bit binary number into 5 ASCII decimal digits (00000-65535),
+ * stored in ascii[0] (ten thousands) to ascii[4] (ones). Takes the same number
+ * of instruction cycles for every value.
+ * 
+ * Example usage: bin16_to_ascii(ADC_read_10bit(), digits);
+ */
+void bin16_to_ascii(unsigned int, unsigned char *);
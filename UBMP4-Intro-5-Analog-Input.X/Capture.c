@@ -0,0 +1,251 @@
+/*==============================================================================
+ Library:   Capture
+ Date:      October 17, 2026
+ 
+ Burst capture functions.
+ 
+ TMR2 auto-triggers every conversion, so samples are evenly spaced no matter
+ how long the capture loop takes, as long as it finishes within one sample
+ period. The loop polls ADIF with interrupts disabled, since an interrupt
+ handler would take too much of a 23us sample period. The buffer index is 16
+ bits, so buffers larger than 256 samples can be used.
+ 
+ Samples are stored in a ring buffer until enough pre-trigger samples have
+ been collected, and the trigger is then checked on each new sample. Once it
+ is found, the buffer is filled with the samples after the trigger, leaving
+ the pre-trigger samples at the start of the buffer.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "Simple-Serial.h"   // Include serial functions used by CAPTURE_WRITE
+#include    "Bin-Dec.h"         // Include binary to decimal conversion
+#include    "Capture.h"         // Include burst capture functions
+
+#if (CAPTURE_SAMPLES & (CAPTURE_SAMPLES - 1)) != 0 || CAPTURE_SAMPLES > 512
+#error CAPTURE_SAMPLES must be a power of 2 no larger than 512
+#endif
+
+// Instruction cycles (FOSC/4) in each sample period used by the conversion
+// and the 2 TAD wait (13.5 TAD of 16 cycles), before the acquisition time
+#define CAPTURE_CONVERSION_CYCLES   216
+#define CAPTURE_US_CYCLES           (_XTAL_FREQ / 4000000)
+
+#if (_XTAL_FREQ / 4) / CAPTURE_MAX_RATE < CAPTURE_CONVERSION_CYCLES + ADC_PIN_ACQUISITION * CAPTURE_US_CYCLES
+#error CAPTURE_MAX_RATE leaves too little acquisition time for the analog pins
+#endif
+
+// ASCII character code definitions
+#define LF      10              // ASCII line feed character code
+#define CR      13              // ASCII carriage return character code
+
+// Capture buffer and settings
+unsigned char captureBuffer[CAPTURE_SAMPLES];
+unsigned char captureChannel = ANQ1;
+unsigned char captureT2CON;             // TMR2 prescaler setting
+unsigned char capturePR2;               // TMR2 period
+unsigned int captureRate;               // Actual sample rate
+unsigned char captureType = CAPTURE_IMMEDIATE;
+unsigned char captureLevel;
+unsigned int capturePre;                // Samples kept before the trigger
+unsigned int captureStart;              // Buffer location of the oldest sample
+unsigned int captureCount;              // Samples in the buffer
+bool captureTriggered;                  // True if the last capture triggered
+
+// Set the capture channel and rate
+unsigned int capture_config(unsigned char channel, unsigned int rate)
+{
+    unsigned long counts;       // Instruction cycles (FOSC/4) per sample
+    unsigned char prescale = 0; // TMR2 prescaler setting (1:1 to 1:64)
+    unsigned char period;       // TMR2 period (PR2)
+    
+    if(rate < CAPTURE_MIN_RATE || rate > CAPTURE_MAX_RATE || !ADC_enable_input(channel))
+    {
+        return (0);
+    }
+    counts = (_XTAL_FREQ / 4 + rate / 2) / rate;
+    while(counts > ((unsigned long)256 << (prescale * 2)))
+    {
+        prescale ++;
+    }
+    period = (unsigned char)(((counts + ((1 << (prescale * 2)) / 2)) >> (prescale * 2)) - 1);
+    
+    // The rounded period must still leave the channel's acquisition time
+    counts = (unsigned long)(period + 1) << (prescale * 2);
+    if(counts < CAPTURE_CONVERSION_CYCLES + (unsigned int)ADC_acquisition_time(channel) * CAPTURE_US_CYCLES)
+    {
+        return (0);
+    }
+    captureChannel = channel;
+    captureT2CON = prescale;
+    capturePR2 = period;
+    captureRate = (unsigned int)((_XTAL_FREQ / 4) / counts);
+    return (captureRate);
+}
+
+// Set the trigger type, level, and pre-trigger sample count
+void capture_trigger(unsigned char type, unsigned char level, unsigned int pretrigger)
+{
+    captureType = type;
+    captureLevel = level;
+    if(pretrigger >= CAPTURE_SAMPLES)
+    {
+        pretrigger = CAPTURE_SAMPLES - 1;
+    }
+    capturePre = pretrigger;
+}
+
+// Capture a burst of samples
+bool capture_run(unsigned int timeout)
+{
+    bool globalInterrupts = GIE;
+    bool triggered = (captureType == CAPTURE_IMMEDIATE);
+    unsigned int head = 0;      // Next buffer location to write
+    unsigned char sample;
+    unsigned char previous = captureLevel;  // No edge on the first sample
+    unsigned int remaining;     // Samples left to capture after the trigger
+    unsigned int collected = 0; // Samples captured before the trigger, up to
+                                // CAPTURE_SAMPLES so that it can't wrap around
+    unsigned int waiting = timeout; // Samples left before timing out
+    
+    if(captureRate == 0)
+    {
+        capture_config(captureChannel, CAPTURE_MAX_RATE);
+    }
+    ADC_stop_sampling();        // Stop any interrupt-driven sampling or scan
+    ADC_select_channel(captureChannel);
+    remaining = (triggered) ? CAPTURE_SAMPLES : CAPTURE_SAMPLES - capturePre;
+    
+    GIE = 0;                    // Interrupts would delay the capture loop
+    TMR2 = 0;
+    PR2 = capturePR2;
+    T2CON = captureT2CON;
+    ADIF = 0;
+    ADCON2 = 0b01010000;        // Auto-conversion trigger on TMR2 match to PR2
+    TMR2ON = 1;
+    
+    while(1)
+    {
+        while(!ADIF)            // Wait for the next conversion
+            ;
+        ADIF = 0;
+        sample = ADRESH;
+        captureBuffer[head & (CAPTURE_SAMPLES - 1)] = sample;
+        head ++;
+        
+        if(triggered)
+        {
+            remaining --;
+            if(remaining == 0)
+            {
+                break;
+            }
+        }
+        else
+        {
+            if(collected != CAPTURE_SAMPLES)
+            {
+                collected ++;
+            }
+            if(collected > capturePre)  // Only check once the pre-trigger
+            {                           // samples have been collected
+                switch(captureType)
+                {
+                    case CAPTURE_ABOVE:
+                        triggered = (sample >= captureLevel);
+                        break;
+                    case CAPTURE_BELOW:
+                        triggered = (sample <= captureLevel);
+                        break;
+                    case CAPTURE_RISING:
+                        triggered = (previous < captureLevel && sample >= captureLevel);
+                        break;
+                    case CAPTURE_FALLING:
+                        triggered = (previous > captureLevel && sample <= captureLevel);
+                        break;
+                }
+                if(triggered)
+                {
+                    remaining --;   // The trigger sample is the first one
+                    if(remaining == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            if(!triggered && timeout != 0)  // A timeout of 0 waits forever
+            {
+                waiting --;
+                if(waiting == 0)
+                {
+                    break;      // No trigger, keep the latest samples
+                }
+            }
+            previous = sample;
+        }
+    }
+    
+    ADCON2 = 0b00000000;        // Disable the auto-conversion trigger
+    TMR2ON = 0;
+    GIE = globalInterrupts;
+    
+    // Find the oldest sample. A full buffer starts at head (which has wrapped
+    // around), and a partly filled one starts at 0.
+    captureCount = (triggered) ? CAPTURE_SAMPLES : collected;
+    captureStart = (captureCount == CAPTURE_SAMPLES) ? head & (CAPTURE_SAMPLES - 1) : 0;
+    captureTriggered = triggered;
+    return (triggered);
+}
+
+// Send the last digitsSent decimal digits of a number using CAPTURE_WRITE
+static void capture_write_number(unsigned int number, unsigned char digitsSent)
+{
+    unsigned char digits[5];
+    
+    bin16_to_ascii(number, digits);
+    for(unsigned char i = 5 - digitsSent; i != 5; i++)
+    {
+        CAPTURE_WRITE(digits[i]);
+    }
+}
+
+// Send the captured samples, oldest first
+void capture_dump(void)
+{
+    unsigned char digits[3];
+    
+    CAPTURE_WRITE('C');
+    CAPTURE_WRITE('A');
+    CAPTURE_WRITE('P');
+    CAPTURE_WRITE(' ');
+    CAPTURE_WRITE('R');
+    capture_write_number(captureRate, 5);
+    CAPTURE_WRITE(' ');
+    CAPTURE_WRITE('N');
+    capture_write_number(captureCount, 3);
+    CAPTURE_WRITE(' ');
+    CAPTURE_WRITE('T');
+    if(captureTriggered)
+    {
+        capture_write_number((captureType == CAPTURE_IMMEDIATE) ? 0 : capturePre, 3);
+    }
+    else
+    {
+        CAPTURE_WRITE('-');     // Timed out without a trigger
+    }
+    CAPTURE_WRITE(CR);
+    CAPTURE_WRITE(LF);
+    
+    for(unsigned int i = 0; i != captureCount; i++)
+    {
+        bin8_to_ascii(captureBuffer[(captureStart + i) & (CAPTURE_SAMPLES - 1)], digits);
+        CAPTURE_WRITE(digits[0]);
+        CAPTURE_WRITE(digits[1]);
+        CAPTURE_WRITE(digits[2]);
+        CAPTURE_WRITE(CR);
+        CAPTURE_WRITE(LF);
+    }
+}
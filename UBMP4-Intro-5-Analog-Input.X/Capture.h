@@ -0,0 +1,89 @@
+/*==============================================================================
+ File:  Capture.h
+ Date:  October 17, 2026
+ 
+ Burst capture function prototypes
+ 
+ Function prototypes for capturing a burst of 8-bit ADC samples into RAM at
+ rates up to CAPTURE_MAX_RATE, far faster than the samples could be sent over
+ a serial link, and then sending (dumping) the captured samples. A trigger
+ level or edge can start the capture, and the samples leading up to the
+ trigger (pre-trigger samples) are kept, like a digital oscilloscope.
+==============================================================================*/
+
+// Capture buffer size. The buffer is larger than a RAM bank, so XC8 places it
+// in linear data memory and accesses it using the FSR registers. Define
+// CAPTURE_SAMPLES in the project's compiler macros for a 512 sample buffer if
+// the other modules leave enough free RAM.
+#ifndef CAPTURE_SAMPLES
+#define CAPTURE_SAMPLES 256         // Must be a power of 2, no larger than 512
+#endif
+
+// Range of capture rates. Each sample period must fit the conversion (11.5
+// TAD = 15.3us at the 1.33us TAD), the 2 TAD wait (2.7us), and the channel's
+// acquisition time (5us for the analog pins), 23us in all. The temperature
+// indicator's 200us acquisition time limits it to a much slower rate.
+#define CAPTURE_MIN_RATE    733     // Slowest rate TMR2 can time with 1:64
+#define CAPTURE_MAX_RATE    43000   // 23.3us sample period (42857 samples/s)
+
+// Trigger types
+#define CAPTURE_IMMEDIATE   0       // Capture without waiting for a trigger
+#define CAPTURE_ABOVE       1       // Trigger on a sample at or above level
+#define CAPTURE_BELOW       2       // Trigger on a sample at or below level
+#define CAPTURE_RISING      3       // Trigger when samples rise through level
+#define CAPTURE_FALLING     4       // Trigger when samples fall through level
+
+// Serial output used by capture_dump(). Define CAPTURE_WRITE in the project's
+// compiler macros to use a different output.
+#ifndef CAPTURE_WRITE
+#define CAPTURE_WRITE(data) H1_serial_write(data)
+#endif
+
+/**
+ * Function: unsigned int capture_config(unsigned char channel,
+ *                                       unsigned int rate)
+ * 
+ * Set the ADC channel and the sample rate (CAPTURE_MIN_RATE to
+ * CAPTURE_MAX_RATE samples per second) used for captures. Returns the actual
+ * sample rate produced by TMR2, or 0 if the rate is out of range, too fast
+ * for the channel's acquisition time, or the channel is not a UBMP4 channel
+ * constant.
+ * 
+ * Example usage: capture_config(ANQ1, 43000);
+ */
+unsigned int capture_config(unsigned char, unsigned int);
+
+/**
+ * Function: void capture_trigger(unsigned char type, unsigned char level,
+ *                                unsigned int pretrigger)
+ * 
+ * Set the trigger type, the 8-bit trigger level, and how many of the samples
+ * before the trigger are kept (less than CAPTURE_SAMPLES).
+ * 
+ * Example usage: capture_trigger(CAPTURE_RISING, 128, 32);
+ */
+void capture_trigger(unsigned char, unsigned char, unsigned int);
+
+/**
+ * Function: bool capture_run(unsigned int timeout)
+ * 
+ * Capture a burst of samples, waiting for the trigger for up to timeout
+ * samples (0 waits forever). Interrupts are disabled during the capture so
+ * that no samples are missed, and TMR2 starts each conversion. Returns true
+ * if the trigger was found, or false on a timeout, in which case the buffer
+ * holds the latest samples. Stops any interrupt-driven ADC sampling or scan.
+ * (Uses TMR2.)
+ * 
+ * Example usage: if(capture_run(50000)) capture_dump();
+ */
+bool capture_run(unsigned int);
+
+/**
+ * Function: void capture_dump(void)
+ * 
+ * Send the captured samples using CAPTURE_WRITE, oldest first. A header line
+ * holds the sample rate, number of samples, and the position of the trigger
+ * sample (e.g. "CAP R42857 N256 T032", or "T-" if the capture timed out),
+ * followed by one 3 digit sample per line.
+ */
+void capture_dump(void);
@@ -20,6 +20,15 @@
 
 #include    "UBMP4.h"           // Include UBMP4 constants and functions
 #include    "Simple-Serial.h"   // Include simple serial functions
+#include    "Profile.h"         // Include profiling probes (if enabled)
+#include    "Bin-Dec.h"         // Include binary to decimal ASCII conversion
+#include    "Scheduler.h"       // Include cooperative task scheduler
+#include    "USB-CDC.h"         // Include USB CDC serial port (if enabled)
+#include    "PWM.h"             // Include hardware PWM functions
+#include    "Tone.h"            // Include timer-generated tone functions
+#include    "LED-Display.h"     // Include interrupt-driven LED display
+#include    "Statistics.h"      // Include streaming statistics
+#include    "Threshold.h"       // Include threshold detection
 
 // TODO Set linker ROM ranges to 'default,-0-7FF' under "Memory model" pull-down.
 // TODO Set linker code offset to '800' under "Additional options" pull-down.
@@ -28,6 +37,50 @@
 #define LF      10              // ASCII line feed character code
 #define CR      13              // ASCII carriage return character code
 
+// Uncomment the line below to compare the ADC noise of normal conversions and
+// conversions made during Sleep by pressing SW4 (conversions are only made in
+// Sleep if no other timer-driven options or USB_CDC are enabled)
+// #define ADC_NOISE_TEST
+#define NOISE_CHANNEL   ANTIM   // Steady ADC input used for the noise test
+ADC_CHECK_CHANNEL(NOISE_CHANNEL);   // Stop the build if it isn't a channel
+
+// Uncomment the line below to play a tone on the beeper with a pitch that
+// follows the ADC input (uses TMR1, so it can't be used with PROFILE)
+// #define TONE_OUTPUT
+
+// Uncomment the line below to show the ADC result as a bar graph on LEDs D2-D5
+// using the interrupt-driven LED display, instead of writing it to LATC
+// #define LED_DISPLAY
+
+// Uncomment the line below to sample STATS_CHANNEL 1000 times per second and
+// send a statistics summary out of H1 once per second instead of running the
+// sample task. Summaries are sent by the interrupt-driven H1 output, so
+// sampling continues while each one is sent (uses TMR1, so it can't be used
+// with TONE_OUTPUT or PROFILE).
+// #define STATS_REPORT
+#define STATS_CHANNEL   ANTIM   // ADC input summarized by the statistics task
+ADC_CHECK_CHANNEL(STATS_CHANNEL);
+
+// Uncomment the line below to sample THRESHOLD_CHANNEL 100 times per second and
+// send a line out of H1 each time it becomes bright or dark, instead of running
+// the sample task. The input must rise to LIGHT_BRIGHT, or fall to LIGHT_DARK,
+// for 3 samples in a row to change state.
+// #define THRESHOLD_REPORT
+#define THRESHOLD_CHANNEL ANQ1  // ADC input checked by the threshold task
+ADC_CHECK_CHANNEL(THRESHOLD_CHANNEL);
+#define LIGHT_BRIGHT    600     // 10-bit level for bright (rising)
+#define LIGHT_DARK      500     // 10-bit level for dark (falling)
+
+// ADC input streamed over USB 5000 times per second if USB_CDC is defined in
+// USB-CDC.h. Use an analog pin: at 5000 samples/s the hold capacitor only has
+// 182us to charge between conversions, less than the 200us the temperature
+// indicator (ANTIM) needs.
+#define STREAM_CHANNEL  ANQ1    // ADC input streamed by the USB task
+ADC_CHECK_CHANNEL(STREAM_CHANNEL);
+#if defined(USB_CDC) && STREAM_CHANNEL == ANTIM
+#error STREAM_CHANNEL can not be ANTIM at 5000 samples/s - use an analog pin
+#endif
+
 // Program variable definitions
 unsigned char rawADC;           // Raw ADC conversion result
 
@@ -39,6 +92,7 @@ unsigned char dec2;             // Decimal digit 2 - hundreds digit
 // Convert an 8-bit binary number to 3 decimal digits
 void bin_to_dec(unsigned char bin)
 {
+    PROFILE_ENTER(PROBE_BIN_TO_DEC);
     dec0 = bin;             // Store number in ones digit
     dec1 = 0;               // Clear tens digit
     dec2 = 0;               // Clear hundreds digit
@@ -55,6 +109,138 @@ void bin_to_dec(unsigned char bin)
         dec1 ++;
         dec0 = dec0 - 10;
     }
+    PROFILE_EXIT(PROBE_BIN_TO_DEC);
+}
+
+// Interrupt service routine. Each driver's interrupt handler checks its own
+// interrupt flag, so handlers for unused peripherals return immediately.
+void __interrupt() interrupt_handler(void)
+{
+#ifdef TONE_OUTPUT
+    tone_isr();                 // Toggle the beeper (before H1, also TMR1)
+#endif
+    H1_serial_isr();            // Send the next H1 bit (early, to limit jitter)
+    H2_serial_isr();            // Detect and sample H2 serial input bits
+    PWM_isr();                  // Update PWM outputs following the ADC
+    ADC_isr();                  // Store completed interrupt-driven conversions
+    EUSART_isr();               // Send the next byte queued for the EUSART
+    LED_display_isr();          // Switch the LEDs (before the tick is counted)
+    scheduler_isr();            // Count scheduler ticks
+#ifdef USB_CDC
+    USB_isr();                  // Enumerate and configure the USB device
+#endif
+}
+
+// Sample task, run every 100ms by the scheduler
+void sample_task(void)
+{
+    // Read selected ADC input and output the result on the PORTC pins
+    rawADC = ADC_read();
+#ifdef LED_DISPLAY
+    LED_display_value(rawADC);
+#else
+    LATC = rawADC;
+#endif
+          
+    // Add serial write code from the program analysis activities here:
+    
+}
+
+#ifdef TONE_OUTPUT
+// Tone task, run every 10ms by the scheduler. Set the beeper pitch from the
+// ADC input, which changes the tone at its next half cycle.
+void tone_task(void)
+{
+    tone_follow(ADC_read());
+}
+#endif
+
+#ifdef STATS_REPORT
+// Statistics task, run every scheduler tick. Add the samples stored in the
+// ADC ring buffer since the last tick to the statistics window, and send the
+// summary when the window is full. Any of the summary that didn't fit in the
+// H1 FIFO is queued on the following ticks.
+void stats_task(void)
+{
+    stats_flush();
+    while(ADC_samples_available() != 0)
+    {
+        if(stats_sample(0, ADC_get_sample() >> 6))  // 10-bit sample
+        {
+            stats_send(0);
+        }
+    }
+}
+#endif
+
+#ifdef THRESHOLD_REPORT
+// Threshold task, run every 10ms by the scheduler. Check the samples stored in
+// the ADC ring buffer since the last run (1 at 100 samples/s) against the
+// light levels, and send a line out of H1 for each change of state.
+void threshold_task(void)
+{
+    while(ADC_samples_available() != 0)
+    {
+        threshold_update(0, ADC_get_sample() >> 6);    // 10-bit sample
+    }
+    threshold_send_events();
+}
+#endif
+
+#ifdef USB_CDC
+// USB task, run every scheduler tick. Send the samples stored in the ADC ring
+// buffer since the last tick (7 samples at 5000 samples/s) over USB.
+void usb_task(void)
+{
+    USB_CDC_send_samples();
+    USB_CDC_flush();
+}
+#endif
+
+// Button task, run every 20ms by the scheduler
+void button_task(void)
+{
+#ifdef ADC_NOISE_TEST
+    // Send the variance (x16) of 64 normal (A) and 64 Sleep (S) conversions
+    // out of H1 if SW4 is pressed
+    if(SW4 == 0)
+    {
+        unsigned char digits[5];
+        
+        bin16_to_ascii(ADC_variance(NOISE_CHANNEL, 6, false), digits);
+        H1_serial_write('A');
+        for(unsigned char i = 0; i != 5; i++)
+        {
+            H1_serial_write(digits[i]);
+        }
+        TMR0IE = 0;             // Pause the scheduler tick so that the
+        bin16_to_ascii(ADC_variance(NOISE_CHANNEL, 6, true), digits);
+        TMR0IE = 1;             // conversions can be made in Sleep
+        H1_serial_write(' ');
+        H1_serial_write('S');
+        for(unsigned char i = 0; i != 5; i++)
+        {
+            H1_serial_write(digits[i]);
+        }
+        H1_serial_write(CR);
+        H1_serial_write(LF);
+        ADC_select_channel(NOISE_CHANNEL);  // Turn the ADC back on
+    }
+#endif
+    
+#ifdef PROFILE
+    // Send the profiling results out of H1 if SW3 is pressed
+    if(SW3 == 0)
+    {
+        profile_report();
+    }
+#endif
+    
+    // Reset the microcontroller and start the bootloader if SW1 is pressed.
+    if(SW1 == 0)
+    {
+        RESET();
+    }
 }
 
 int main(void)
@@ -63,6 +249,9 @@ int main(void)
     UBMP4_config();             // Configure I/O for on-board UBMP4 devices
     ADC_config();               // Configure ADC and enable input on Q1
     H1_serial_config();         // Prepare for serial output on H1
+#ifdef PROFILE
+    profile_start();            // Start TMR1 for the profiling probes
+#endif
         
     // If Q1 and U2 are not installed, all PORTC outputs can be enabled for
     // debugging using a multimeter by uncommenting the line below:
@@ -74,29 +263,44 @@ int main(void)
     // Select the on-die temperature indicator module as the ADC input and wait
     // for the recommended acquisition time before A-D conversion
     ADC_select_channel(ANTIM);
-    __delay_us(200);
+    __delay_us(ADC_TEMP_ACQUISITION);
     
     // If the components are installed, turn on LED D6 and select
     // phototransistor Q1 as the ADC input
     // D6 = 1;                      // Turn LED D6 on and...
     // ADC_select_channel(ANQ1);    // read the light level on Q1
     
-    while(1)
-    {
-        // Read selected ADC input and output the result on the PORTC pins
-        rawADC = ADC_read();
-        LATC = rawADC;
-              
-        // Add serial write code from the program analysis activities here:
-        
-        __delay_ms(100);
-        
-        // Reset the microcontroller and start the bootloader if SW1 is pressed.
-        if(SW1 == 0)
-        {
-            RESET();
-        }
-    }
+    // Run the sample and button tasks at their own rates. The button task
+    // starts 10ms later so that the two tasks don't share a tick.
+#ifdef USB_CDC
+    // Stream timed samples over USB instead of running the sample task
+    USB_CDC_start();
+    ADC_START_TIMED_SAMPLING(STREAM_CHANNEL, 5000);
+    scheduler_add(usb_task, 1, 0);
+#elif defined(STATS_REPORT)
+    // Summarize one second of timed samples at a time
+    H1_serial_start();
+    stats_config(0, 1000);
+    ADC_START_TIMED_SAMPLING(STATS_CHANNEL, 1000);
+    scheduler_add(stats_task, 1, 0);
+#elif defined(THRESHOLD_REPORT)
+    // Report changes in the light level instead of every sample
+    threshold_config(0, LIGHT_BRIGHT, LIGHT_DARK, 3);
+    ADC_START_TIMED_SAMPLING(THRESHOLD_CHANNEL, 100);
+    scheduler_add(threshold_task, SCHED_MS(10), 0);
+#else
+    scheduler_add(sample_task, SCHED_MS(100), 0);
+#endif
+#ifdef TONE_OUTPUT
+    tone_start();
+    scheduler_add(tone_task, SCHED_MS(10), SCHED_MS(5));
+#endif
+#ifdef LED_DISPLAY
+    LED_display_start(LED_MODE_BAR);
+#endif
+    scheduler_add(button_task, SCHED_MS(20), SCHED_MS(10));
+    scheduler_start();
+    scheduler_run();            // Run the tasks (never returns)
 }
 
 /* Learn More -- Program Analysis Activities
@@ -262,39 +466,36 @@ int main(void)
  *      Can you determine what this statement is doing, and why an AND operation
  *      is being used instead of just over-writing TRISB with a new value?
  * 
- * 10.  The data transmission loop of the H1_serial_write() function is shown
- *      below:
+ * 10.  The H1_serial_write() function writes each of the 8 data bits using
+ *      the H1_WRITE_DATA() block in Simple-Serial.c. On the PIC, the block is
+ *      made of assembly instructions, but the host simulator's version of it
+ *      does the same thing in C:
  * 
-    // Shift 8 data bits out LSB first
-    for(unsigned char bits = 8; bits != 0; bits--)
-    {
-        if((data & 0b00000001) == 0)    // Check the least significant bit state
-        {
-            H1OUT = 0;
-        }
-        else
-        {
-            H1OUT = 1;
-        }
-        __delay_us(103);    // Shorter delay to account for 'for' loop overhead
-        data = data >> 1;   // Prepare next bit by shifting data right 1 bit
-    }
+    H1OUT = h1WriteData & 1;    // Output the least significant bit
+    h1WriteData >>= 1;          // Prepare the next bit by shifting right 1 bit
  *  
- *      Explain how the AND operation used in the if condition in this function
- *      can determine the state of the least significant data bit.
+ *      Explain how the AND operation can determine the state of the least
+ *      significant data bit. An earlier version used an if-else statement to
+ *      set H1OUT to 0 or 1. Why could that make 0 bits and 1 bits take
+ *      different numbers of instruction cycles?
  * 
  * 11.  The AND operation examined in 10, above, only tests the state of the
  *      least significant bit of the data to be transmitted. How are the
- *      remaining seven bits of the data transmitted in this same loop?
+ *      remaining seven bits of the data transmitted by the same block?
  * 
- * 12.  The ADC_select_channel() function uses the following two instructions to
+ * 12.  The ADC_select_channel() function uses the following instruction to
  *      switch the ADC's input mux to the selected analog input.
  * 
-    ADCON0 = (ADCON0 & 0b10000011); // Clear channel select (CHS) bits by ANDing
-    ADCON0 = (ADCON0 | channel);	// Set channel by ORing with channel constant
+        ADCON0 = ADC_CHANNEL(channel).adcon0;
  * 
+ *      ADC_CHANNEL() looks up the channel in the adcChannels table in the
+ *      UBMP4.c file, which holds the complete ADCON0 value for each channel.
  *      How will the ADCON0 register be changed after calling the function with
- *      the ADQ1 definition from the UBMP4.h file?
+ *      the ANQ1 definition from the UBMP4.h file? Why is the channel constant
+ *      shifted right by two bits to find its place in the table? An earlier
+ *      version of the function cleared the channel bits with an AND operation
+ *      and then set them with an OR operation. What could go wrong if the
+ *      ADC input mux is briefly switched to channel 0 between the two steps?
  * 
  * Programming Activities
  * 
@@ -343,6 +544,13 @@ int main(void)
  *      any bit(s) within memory registers and is a powerful technique to
  *      understand.
  * 
+ *      The delays in this code hold up the scheduler for 1.6 seconds, so the
+ *      button task can't run until they finish, and the missed button task
+ *      releases are counted in scheduler_overruns[1]. How could the sample
+ *      task display the two halves of the result without using delays?
+ *      Compare your answer with LED_MODE_NIBBLES in the LED-Display.c file,
+ *      which is timed by the scheduler's TMR0 interrupt.
+ * 
  * 3.   Create a program to light an LED when a specific light threshold is
  *      crossed. Start by determining the analog output level corresponding
  *      a medium intensity of light using either the code modifications from
@@ -363,11 +571,14 @@ int main(void)
  *      that creates a tone having a pitch proportional to an analog value.
  * 
  * 5.   If you have an oscilloscope available, investigate how fast you can get
- *      the serial output function to transmit data. Try setting the bit delays
- *      inside the serial write function to 1 microsecond of delay, instead of
- *      104 and 103 as used in the current function, and try the program. Does
- *      it work the way it should? Is each bit actually 1us in duration? What do
- *      you think is affecting the length of the bits?
+ *      the serial output function to transmit data. The bit delays inside the
+ *      serial write function are calculated from the H1_BAUD definition in the
+ *      Simple-Serial.h file. Try setting H1_BAUD to 115200, rebuild the
+ *      program, and try it. Does it work the way it should? Is each bit the
+ *      right duration? Why does the build stop with an error if you set
+ *      H1_BAUD to 2000000? What do you think is affecting the length of the
+ *      bits, and why do the H1_LOOP_CYCLES and similar definitions in
+ *      Simple-Serial.c exist?
  * 
  * 6.   Creating a serial data transmission function is relatively straight-
  *      forward since the bits are simply output sequentially. Receiving serial
@@ -0,0 +1,206 @@
+/*==============================================================================
+ Library:   LED-Display
+ Date:      October 17, 2026
+ 
+ Interrupt-driven binary code modulation LED display functions.
+ 
+ The LED states for each slice (bit plane) are worked out when a value or
+ level is set, so the interrupt handler only has to write one of them to
+ LATC. New bit planes are written to a pending copy and the handler copies
+ them at the start of the next frame, so a frame never shows a mix of old
+ and new values. ledPendingReady is cleared while the pending copy is being
+ written, so the handler can't copy it half-written.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "Scheduler.h"       // Include scheduler tick definitions
+#include    "LED-Display.h"     // Include LED display functions
+
+#if LED_BCM_BITS < 1 || LED_BCM_BITS > 4
+#error LED_BCM_BITS must be from 1 to 4
+#endif
+
+#define LED_MASK        0b11110000  // LATC bits used by LEDs D2-D5
+
+// Nibble mode times in scheduler ticks
+#define LED_NIBBLE_HIGH_TICKS   SCHED_MS(500)
+#define LED_NIBBLE_LOW_TICKS    SCHED_MS(1000)
+#define LED_NIBBLE_OFF_TICKS    SCHED_MS(100)
+
+unsigned char ledPlanes[LED_BCM_BITS];      // LED states for each slice
+unsigned char ledPending[LED_BCM_BITS];     // Bit planes for the next frame
+volatile bool ledPendingReady;              // Set when ledPending is complete
+unsigned char ledLevels[LED_COUNT];         // LED_MODE_LEVELS brightness levels
+
+unsigned char ledMode;                      // Display mode
+volatile unsigned char ledValue;            // Value shown in nibble mode
+bool ledRunning;                            // Display is on
+
+unsigned char ledSlice;                     // Bit plane being shown
+unsigned char ledSliceTicks;                // Ticks left in this slice
+unsigned char ledNibble;                    // Nibble mode phase (0-2)
+unsigned int ledNibbleTicks;                // Ticks left in this phase
+
+// Work out the bit planes for a set of LED levels and pass them to the
+// interrupt handler
+static void LED_display_planes(unsigned char *levels)
+{
+    ledPendingReady = false;
+    for(unsigned char bit = 0; bit != LED_BCM_BITS; bit++)
+    {
+        unsigned char plane = 0;
+        
+        for(unsigned char led = LED_COUNT; led != 0; led--)
+        {
+            plane = plane << 1;
+            if(levels[led - 1] & (1 << bit))
+            {
+                plane = plane | 0b00010000;
+            }
+        }
+        ledPending[bit] = plane;
+    }
+    ledPendingReady = true;
+}
+
+// Start the display
+void LED_display_start(unsigned char mode)
+{
+    ledRunning = false;         // Pause the handler while starting
+    for(unsigned char led = 0; led != LED_COUNT; led++)
+    {
+        ledLevels[led] = 0;
+    }
+    for(unsigned char bit = 0; bit != LED_BCM_BITS; bit++)
+    {
+        ledPlanes[bit] = 0;
+    }
+    ledPendingReady = false;
+    ledMode = mode;
+    ledValue = 0;
+    ledSlice = LED_BCM_BITS - 1;
+    ledSliceTicks = 1;          // Start a new frame at the next tick
+    ledNibble = 2;
+    ledNibbleTicks = 1;
+    ledRunning = true;
+}
+
+// Stop the display
+void LED_display_stop(void)
+{
+    ledRunning = false;
+    LATC = LATC & ~LED_MASK;
+}
+
+// Display a value in the current mode
+void LED_display_value(unsigned char value)
+{
+    unsigned char levels[LED_COUNT];
+    
+    ledValue = value;
+    if(ledMode == LED_MODE_BAR)
+    {
+        // Bar length in LED levels, rounded to the nearest level
+        unsigned char length = (unsigned char)(((unsigned int)value * (LED_COUNT * LED_MAX_LEVEL) + 127) / 255);
+        
+        for(unsigned char led = 0; led != LED_COUNT; led++)
+        {
+            if(length >= LED_MAX_LEVEL)
+            {
+                levels[led] = LED_MAX_LEVEL;
+                length -= LED_MAX_LEVEL;
+            }
+            else
+            {
+                levels[led] = length;
+                length = 0;
+            }
+        }
+        LED_display_planes(levels);
+    }
+    else if(ledMode == LED_MODE_BRIGHTNESS)
+    {
+        for(unsigned char led = 0; led != LED_COUNT; led++)
+        {
+            levels[led] = value >> (8 - LED_BCM_BITS);
+        }
+        LED_display_planes(levels);
+    }
+}
+
+// Set the brightness of one LED
+void LED_display_level(unsigned char led, unsigned char level)
+{
+    if(led < LED_COUNT)
+    {
+        ledLevels[led] = (level > LED_MAX_LEVEL) ? LED_MAX_LEVEL : level;
+        LED_display_planes(ledLevels);
+    }
+}
+
+// Start a new frame, using new bit planes or the next nibble if ready
+static void LED_display_frame(void)
+{
+    if(ledMode == LED_MODE_NIBBLES)
+    {
+        ledNibbleTicks -= (1 << LED_BCM_BITS) - 1;
+        if((signed int)ledNibbleTicks <= 0)
+        {
+            unsigned char pattern;
+            
+            ledNibble = (ledNibble == 2) ? 0 : ledNibble + 1;
+            if(ledNibble == 0)
+            {
+                pattern = ledValue & LED_MASK;
+                ledNibbleTicks = LED_NIBBLE_HIGH_TICKS;
+            }
+            else if(ledNibble == 1)
+            {
+                pattern = (unsigned char)(ledValue << 4);
+                ledNibbleTicks = LED_NIBBLE_LOW_TICKS;
+            }
+            else
+            {
+                pattern = 0;
+                ledNibbleTicks = LED_NIBBLE_OFF_TICKS;
+            }
+            for(unsigned char bit = 0; bit != LED_BCM_BITS; bit++)
+            {
+                ledPlanes[bit] = pattern;
+            }
+        }
+    }
+    else if(ledPendingReady)
+    {
+        for(unsigned char bit = 0; bit != LED_BCM_BITS; bit++)
+        {
+            ledPlanes[bit] = ledPending[bit];
+        }
+        ledPendingReady = false;
+    }
+}
+
+// Show the next bit plane at the end of each slice. Slice n lasts 2^n ticks.
+// TMR0IF is left set for scheduler_isr().
+void LED_display_isr(void)
+{
+    if(TMR0IF && TMR0IE && ledRunning)
+    {
+        ledSliceTicks --;
+        if(ledSliceTicks == 0)
+        {
+            ledSlice ++;
+            if(ledSlice == LED_BCM_BITS)
+            {
+                ledSlice = 0;
+                LED_display_frame();
+            }
+            ledSliceTicks = 1 << ledSlice;
+            LATC = (LATC & ~LED_MASK) | ledPlanes[ledSlice];
+        }
+    }
+}
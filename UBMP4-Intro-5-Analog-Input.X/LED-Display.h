@@ -0,0 +1,80 @@
+/*==============================================================================
+ File:  LED-Display.h
+ Date:  October 17, 2026
+ 
+ Interrupt-driven LED display function prototypes
+ 
+ Function prototypes for displaying values on LEDs D2-D5 (RC4-RC7) using
+ binary code modulation (BCM). Each LED has a brightness level from 0 (off)
+ to LED_MAX_LEVEL (fully on). Each frame is split into one time slice per
+ level bit, with each slice twice as long as the one before it, and the LEDs
+ are switched at the start of each slice. This gives every LED its own
+ brightness for only LED_BCM_BITS interrupts per frame.
+ 
+ The slices are timed by the scheduler's TMR0 tick (1.365ms), so the display
+ doesn't use another timer. A frame lasts (2^LED_BCM_BITS - 1) ticks, which is
+ 9.6ms (105 Hz) for the default 3 bits. More bits would give more brightness
+ levels but would make the LEDs flicker. scheduler_start() must be called to
+ start TMR0.
+ 
+ Only the LED bits of LATC are written, so RC0-RC3 keep working as inputs
+ (and the LEDs should not be written directly while the display is on).
+==============================================================================*/
+
+// Display settings
+#define LED_BCM_BITS    3           // Brightness level bits (1 to 4)
+#define LED_MAX_LEVEL   ((1 << LED_BCM_BITS) - 1)
+#define LED_COUNT       4           // LEDs D2 (RC4) to D5 (RC7)
+
+// Display modes
+#define LED_MODE_LEVELS     0       // Brightness set for each LED
+#define LED_MODE_BAR        1       // Bar graph with a dimmed top LED
+#define LED_MODE_BRIGHTNESS 2       // All LEDs at a brightness set by the value
+#define LED_MODE_NIBBLES    3       // Upper 4 bits for 500ms, lower 4 bits for
+                                    // 1000ms, then off for 100ms
+
+/**
+ * Function: void LED_display_start(unsigned char mode)
+ * 
+ * Start the display in a mode, with all LEDs off.
+ * 
+ * Example usage: LED_display_start(LED_MODE_BAR);
+ */
+void LED_display_start(unsigned char);
+
+/**
+ * Function: void LED_display_stop(void)
+ * 
+ * Stop the display and turn LEDs D2-D5 off.
+ */
+void LED_display_stop(void);
+
+/**
+ * Function: void LED_display_value(unsigned char value)
+ * 
+ * Display an 8-bit value (such as an ADC result) in the current mode. In bar
+ * graph mode the bar is LED_COUNT x LED_MAX_LEVEL steps long, lit from D2. The
+ * new value is shown from the start of the next frame.
+ * 
+ * Example usage: LED_display_value(ADC_read());
+ */
+void LED_display_value(unsigned char);
+
+/**
+ * Function: void LED_display_level(unsigned char led, unsigned char level)
+ * 
+ * Set the brightness of one LED, from 0 (D2) to LED_COUNT - 1 (D5), in
+ * LED_MODE_LEVELS mode. The new level is shown from the start of the next
+ * frame.
+ * 
+ * Example usage: LED_display_level(0, LED_MAX_LEVEL / 2);
+ */
+void LED_display_level(unsigned char, unsigned char);
+
+/**
+ * Function: void LED_display_isr(void)
+ * 
+ * Switch the LEDs at the end of each time slice. Call from the interrupt
+ * service routine before scheduler_isr(), which clears TMR0IF.
+ */
+void LED_display_isr(void);
@@ -0,0 +1,238 @@
+/*==============================================================================
+ Library:   PWM
+ Date:      October 17, 2026
+ 
+ Hardware PWM functions.
+ 
+ A PWM duty cycle register holds the number of Tosc (1/48 MHz) periods that
+ the output is on, and the PWM period is 4 x (PR2 + 1) x prescale Tosc
+ periods, so a duty cycle of 4 x (PR2 + 1) is always on.
+ 
+ When following the ADC, conversions are timed by the PWM's own TMR2
+ period (every 1 to 16 periods, using the postscaler), so the PWM frequency
+ set by PWM_start() is kept. Each 10-bit ADC result is passed through the
+ transfer curve, interpolating to a 10-bit output, and scaled to the PWM
+ period by multiplying it by PR2 + 1 and dividing by 256. The multiply is
+ split into the upper 8 and lower 2 bits of the output so that each part
+ fits in 16 bits for every PR2 value. The duty cycle then has as many levels
+ as the PWM period has steps, up to the ADC's 10 bits.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+#include    "stddef.h"          // Include NULL definition
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "PWM.h"             // Include PWM functions
+
+// Built-in transfer curves
+const unsigned char PWM_curve_square[PWM_CURVE_POINTS] = {
+    0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225, 255
+};
+const unsigned char PWM_curve_invert[PWM_CURVE_POINTS] = {
+    255, 240, 224, 208, 192, 176, 160, 144, 128, 112, 96, 80, 64, 48, 32, 16, 0
+};
+const unsigned char pwmCurveLinear[PWM_CURVE_POINTS] = {
+    0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 255
+};
+
+// Curves used by PWM outputs following the ADC (NULL when not following)
+const unsigned char *pwm1Curve;
+const unsigned char *pwm2Curve;
+
+// Set a PWM output's 10-bit duty cycle register. A period of 1024 steps (PR2
+// = 255) can't be always on, so its full scale is on for 1023 of them.
+static void PWM_write_duty(unsigned char pwm, unsigned int duty)
+{
+    if(duty > 1023)
+    {
+        duty = 1023;
+    }
+    if(pwm == PWM1)
+    {
+        PWM1DCH = (unsigned char)(duty >> 2);   // Upper 8 bits
+        PWM1DCL = (unsigned char)(duty << 6);   // Lower 2 bits in bits 7-6
+    }
+    else
+    {
+        PWM2DCH = (unsigned char)(duty >> 2);
+        PWM2DCL = (unsigned char)(duty << 6);
+    }
+}
+
+// Enable a PWM output
+static void PWM_enable(unsigned char pwm)
+{
+    if(pwm == PWM1)
+    {
+        PWM1CON = 0b11000000;   // Enable PWM1 and its output, active high
+    }
+    else
+    {
+        PWM2CON = 0b11000000;   // Enable PWM2 and its output, active high
+    }
+}
+
+// Set TMR2 for the PWM frequency
+unsigned long PWM_start(unsigned long frequency)
+{
+    unsigned long counts;       // Instruction cycles (FOSC/4) per PWM period
+    unsigned char prescale = 0; // T2CKPS prescaler select bits (1:1 to 1:64)
+    
+    if(frequency < PWM_MIN_FREQUENCY || frequency > PWM_MAX_FREQUENCY)
+    {
+        return (0);
+    }
+    counts = (_XTAL_FREQ / 4 + frequency / 2) / frequency;
+    while(prescale < 3 && counts > ((unsigned long)256 << (prescale * 2)))
+    {
+        prescale ++;
+    }
+    
+    TMR2ON = 0;                 // Stop and reset TMR2 before reconfiguring it
+    TMR2 = 0;
+    PR2 = (unsigned char)(((counts + ((1 << (prescale * 2)) / 2)) >> (prescale * 2)) - 1);
+    T2CON = prescale;           // 1:1 postscaler
+    TMR2ON = 1;
+    return (PWM_frequency());
+}
+
+// Return the number of duty cycle steps in each period
+unsigned int PWM_steps(void)
+{
+    return (((unsigned int)PR2 + 1) << 2);
+}
+
+// Return the PWM resolution in whole bits
+unsigned char PWM_resolution(void)
+{
+    unsigned char bits = 0;
+    
+    for(unsigned int steps = PWM_steps(); steps > 1; steps >>= 1)
+    {
+        bits ++;
+    }
+    return (bits);
+}
+
+// Return the PWM frequency
+unsigned long PWM_frequency(void)
+{
+    unsigned char prescale = T2CON & 0b00000011;
+    
+    return ((_XTAL_FREQ / 4) / (((unsigned long)PR2 + 1) << (prescale * 2)));
+}
+
+// Enable a PWM output and set its duty cycle
+void PWM_set_duty(unsigned char pwm, unsigned int duty)
+{
+    if(duty > PWM_steps())
+    {
+        duty = PWM_steps();
+    }
+    PWM_write_duty(pwm, duty);
+    PWM_enable(pwm);
+}
+
+// Disable a PWM output
+void PWM_stop(unsigned char pwm)
+{
+    if(pwm == PWM1)
+    {
+        pwm1Curve = NULL;
+        PWM1CON = 0;
+    }
+    else
+    {
+        pwm2Curve = NULL;
+        PWM2CON = 0;
+    }
+}
+
+// Follow an ADC channel with a PWM output, sampling every few PWM periods
+unsigned int PWM_follow(unsigned char pwm, unsigned char channel, unsigned int rate, const unsigned char *curve)
+{
+    unsigned long frequency = PWM_frequency();
+    unsigned long ratio;        // PWM periods per sample, rounded
+    unsigned char periods;      // PWM periods per sample (TMR2 postscaler)
+    
+    if(!TMR2ON || rate == 0)
+    {
+        return (0);             // PWM_start() sets the PWM and sample timer
+    }
+    ratio = (frequency + rate / 2) / rate;
+    periods = (ratio > 16) ? 16 : (ratio == 0) ? 1 : (unsigned char)ratio;
+    while(periods < 16 && frequency / periods > ADC_MAX_RATE)
+    {
+        periods ++;             // Limit the rate to what ADC_isr() can handle
+    }
+    if(curve == NULL)
+    {
+        curve = pwmCurveLinear;
+    }
+    if(pwm == PWM1)
+    {
+        pwm1Curve = curve;
+    }
+    else
+    {
+        pwm2Curve = curve;
+    }
+    PWM_write_duty(pwm, 0);
+    PWM_enable(pwm);
+    return (ADC_start_tmr2_sampling(channel, periods));
+}
+
+// Pass a 10-bit ADC result through a transfer curve and scale it to the PWM
+// period
+static unsigned int PWM_transfer(const unsigned char *curve, unsigned int input)
+{
+    unsigned char segment = (unsigned char)(input >> 6);
+    unsigned char start = curve[segment];
+    unsigned char fraction = input & 0x3F;
+    unsigned int output;        // 10-bit output, 4 x the curve's 8-bit points
+    unsigned int period = (unsigned int)PR2 + 1;
+    
+    // Interpolate between the curve points, using the difference from the
+    // point above (the last segment is 63 counts wide instead of 64)
+    if(input == 1023)
+    {
+        output = (unsigned int)curve[PWM_CURVE_POINTS - 1] << 2;
+    }
+    else if(curve[segment + 1] >= start)
+    {
+        output = ((unsigned int)start << 2) + (((unsigned int)(curve[segment + 1] - start) * fraction) >> 4);
+    }
+    else
+    {
+        output = ((unsigned int)start << 2) - (((unsigned int)(start - curve[segment + 1]) * fraction) >> 4);
+    }
+    
+    // Full scale (255 x 4) is always on, otherwise scale by 4 x (PR2 + 1) /
+    // 1024, multiplying the upper 8 and lower 2 bits separately
+    if(output == 1020)
+    {
+        return (period << 2);
+    }
+    return ((((output >> 2) * period) + (((output & 0b00000011) * period) >> 2)) >> 6);
+}
+
+// ADC conversion-complete handler for PWM outputs following the ADC. ADIF is
+// left set for ADC_isr().
+void PWM_isr(void)
+{
+    if(ADIF && ADIE && (pwm1Curve != NULL || pwm2Curve != NULL))
+    {
+        unsigned int input = ((unsigned int)ADRESH << 2) | (ADRESL >> 6);
+        
+        if(pwm1Curve != NULL)
+        {
+            PWM_write_duty(PWM1, PWM_transfer(pwm1Curve, input));
+        }
+        if(pwm2Curve != NULL)
+        {
+            PWM_write_duty(PWM2, PWM_transfer(pwm2Curve, input));
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/*==============================================================================
+ File:  PWM.h
+ Date:  October 17, 2026
+ 
+ Hardware PWM function prototypes
+ 
+ Function prototypes for the PIC16F1459 PWM1 (RC5, LED D3/D6 and H6) and PWM2
+ (RC6, LED D4 and H7) outputs. Both outputs share TMR2 as their time base, so
+ they always have the same frequency. Once a duty cycle is set, the PWM
+ hardware produces the output by itself, with no CPU time used.
+ 
+ The number of duty cycle steps in each PWM period is 4 x (PR2 + 1), so lower
+ frequencies have more resolution, up to 10 bits. When following the ADC,
+ PWM_follow() samples once every 1 to 16 PWM periods, no faster than
+ ADC_MAX_RATE, and uses 10-bit results, so the same resolution applies:
+ 
+   Frequency    TMR2 prescaler  PR2     Steps   Resolution  Follow rates
+   187500 Hz    1:1             63      256     8 bits      11719-18750 Hz
+   93750 Hz     1:1             127     512     9 bits      5859-18750 Hz
+   46875 Hz     1:1             255     1024    10 bits     2930-15625 Hz
+   20000 Hz     1:4             149     600     9.2 bits    1250-20000 Hz
+   11719 Hz     1:4             255     1024    10 bits     732-11719 Hz
+   2930 Hz      1:16            255     1024    10 bits     183-2930 Hz
+   733 Hz       1:64            255     1024    10 bits     46-733 Hz
+ 
+ PWM_steps() and PWM_resolution() report the resolution at the frequency
+ actually set.
+==============================================================================*/
+
+// PWM outputs
+#define PWM1            1           // RC5 (LED D3/D6, H6)
+#define PWM2            2           // RC6 (LED D4, H7)
+
+// PWM frequency limits (Hz)
+#define PWM_MIN_FREQUENCY   733     // PR2 = 255 with the 1:64 prescaler
+#define PWM_MAX_FREQUENCY   187500  // 8 bits of resolution
+
+// Transfer curves for PWM_follow(). Each curve has 17 points, giving the
+// 8-bit output at 10-bit ADC inputs of 0, 64, 128 ... 960 and 1023, and the
+// output is interpolated between the points to 10 bits. Use NULL for a
+// straight line.
+#define PWM_CURVE_POINTS    17
+extern const unsigned char PWM_curve_square[PWM_CURVE_POINTS];  // LED brightness
+extern const unsigned char PWM_curve_invert[PWM_CURVE_POINTS];  // Dark = bright
+
+/**
+ * Function: unsigned long PWM_start(unsigned long frequency)
+ * 
+ * Set TMR2 for a PWM frequency from PWM_MIN_FREQUENCY to PWM_MAX_FREQUENCY,
+ * using the smallest TMR2 prescaler (and so the highest resolution) possible.
+ * Returns the actual frequency, or 0 if the frequency is out of range.
+ * (Uses TMR2, so it can't be used with ADC timed sampling, scans, or H2
+ * serial input.)
+ * 
+ * Example usage: PWM_start(20000);
+ */
+unsigned long PWM_start(unsigned long);
+
+/**
+ * Function: unsigned int PWM_steps(void)
+ * 
+ * Return the number of duty cycle steps in each PWM period, 4 x (PR2 + 1).
+ */
+unsigned int PWM_steps(void);
+
+/**
+ * Function: unsigned char PWM_resolution(void)
+ * 
+ * Return the PWM resolution in whole bits (the number of bits needed to
+ * count PWM_steps() steps, rounded down).
+ */
+unsigned char PWM_resolution(void);
+
+/**
+ * Function: unsigned long PWM_frequency(void)
+ * 
+ * Return the PWM frequency set by the TMR2 prescaler and PR2.
+ */
+unsigned long PWM_frequency(void);
+
+/**
+ * Function: void PWM_set_duty(unsigned char pwm, unsigned int duty)
+ * 
+ * Enable a PWM output and set its duty cycle, from 0 (always off) to
+ * PWM_steps() (always on, except at 1024 steps, where the 10-bit duty cycle
+ * register can only be on for 1023).
+ * 
+ * Example usage: PWM_set_duty(PWM1, PWM_steps() / 2);  // 50% duty cycle
+ */
+void PWM_set_duty(unsigned char, unsigned int);
+
+/**
+ * Function: void PWM_stop(unsigned char pwm)
+ * 
+ * Disable a PWM output and stop it following an ADC channel. The pin returns
+ * to being controlled by its LATC bit.
+ */
+void PWM_stop(unsigned char);
+
+/**
+ * Function: unsigned int PWM_follow(unsigned char pwm, unsigned char channel,
+ *                                   unsigned int rate, const unsigned char *curve)
+ * 
+ * Make a PWM output's duty cycle follow an ADC channel. Call PWM_start()
+ * first: its TMR2 period times both the PWM and the ADC conversions, which
+ * are made every 1 to 16 PWM periods (the TMR2 postscaler), whichever is
+ * closest to rate samples per second without being faster than ADC_MAX_RATE
+ * (see the table above). The PWM frequency is not changed. Each completed
+ * conversion updates the duty cycle through the transfer curve (NULL for a
+ * straight line) in PWM_isr(), using the full 10-bit result. Both PWM outputs
+ * can follow the same channel using different curves. Samples are also
+ * stored in the ADC ring buffer. Returns the actual sample rate, or 0 if the
+ * PWM hasn't been started or the channel is not valid. (Uses TMR2.)
+ * 
+ * Example usage: PWM_start(20000); PWM_follow(PWM1, ANQ1, 1000, PWM_curve_square);
+ */
+unsigned int PWM_follow(unsigned char, unsigned char, unsigned int, const unsigned char *);
+
+/**
+ * Function: void PWM_isr(void)
+ * 
+ * Update the duty cycle of any PWM outputs following the ADC. Call from the
+ * interrupt service routine before ADC_isr(), which clears ADIF.
+ */
+void PWM_isr(void);
@@ -0,0 +1,137 @@
+/*==============================================================================
+ Library:   Profile
+ Date:      October 17, 2026
+ 
+ Cycle profiling functions. See Profile.h for how probes are used. Nothing in
+ this file is compiled unless PROFILE is defined.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "Simple-Serial.h"   // Include serial functions for reports
+#include    "Bin-Dec.h"         // Include binary to decimal conversions
+#include    "Profile.h"         // Include profiling probes
+
+#ifdef PROFILE
+
+// Probe results (in instruction cycles)
+unsigned int profileStart[PROFILE_PROBES];  // TMR1 count at profile_enter()
+unsigned int profileMin[PROFILE_PROBES];    // Shortest time
+unsigned int profileMax[PROFILE_PROBES];    // Longest time
+unsigned long profileTotal[PROFILE_PROBES]; // Sum of all times
+unsigned int profileCount[PROFILE_PROBES];  // Number of times recorded
+unsigned int profileOverhead;               // Cycles used by the probes
+bool profilePaused;                         // Ignore probes while reporting
+
+// Read the running TMR1. If TMR1L overflows between reading the two bytes,
+// TMR1H will have changed, so read both again.
+static unsigned int profile_timer(void)
+{
+    unsigned char high;
+    unsigned char low;
+    
+    do
+    {
+        high = TMR1H;
+        low = TMR1L;
+    }
+    while(high != TMR1H);
+    return (((unsigned int)high << 8) | low);
+}
+
+// Clear all results, start TMR1, and measure the probe overhead
+void profile_start(void)
+{
+    T1GCON = 0b00000000;        // TMR1 gate disabled
+    T1CON = 0b00000001;         // TMR1 on, FOSC/4 clock, 1:1 prescaler
+    TMR1IE = 0;                 // TMR1 free-runs, no interrupts are needed
+    
+    profileOverhead = 0;
+    profilePaused = false;
+    for(unsigned char probe = 0; probe != PROFILE_PROBES; probe++)
+    {
+        profileMin[probe] = 0xFFFF;
+        profileMax[probe] = 0;
+        profileTotal[probe] = 0;
+        profileCount[probe] = 0;
+    }
+    
+    // Time an empty probe (using probe 0), then clear its results
+    profile_enter(0);
+    profile_exit(0);
+    profileOverhead = profileMin[0];
+    profileMin[0] = 0xFFFF;
+    profileMax[0] = 0;
+    profileTotal[0] = 0;
+    profileCount[0] = 0;
+}
+
+// Record the start time of a probe
+void profile_enter(unsigned char probe)
+{
+    profileStart[probe] = profile_timer();
+}
+
+// Add the time since profile_enter() to the probe's results
+void profile_exit(unsigned char probe)
+{
+    unsigned int cycles = profile_timer() - profileStart[probe];
+    
+    if(profilePaused || profileCount[probe] == 0xFFFF)
+    {
+        return;                 // Reporting, or the call counter is full
+    }
+    cycles = cycles - profileOverhead;
+    if(cycles < profileMin[probe])
+    {
+        profileMin[probe] = cycles;
+    }
+    if(cycles > profileMax[probe])
+    {
+        profileMax[probe] = cycles;
+    }
+    profileTotal[probe] += cycles;
+    profileCount[probe] ++;
+}
+
+// Write a label followed by a 5-digit decimal number
+static void profile_write_value(unsigned char label, unsigned int value)
+{
+    unsigned char digits[5];
+    
+    bin16_to_ascii(value, digits);
+    H1_serial_write(label);
+    for(unsigned char i = 0; i != 5; i++)
+    {
+        H1_serial_write(digits[i]);
+    }
+    H1_serial_write(' ');
+}
+
+// Write the results of every probe out of H1
+void profile_report(void)
+{
+    unsigned int average;
+    
+    profilePaused = true;       // Don't profile the report itself
+    for(unsigned char probe = 0; probe != PROFILE_PROBES; probe++)
+    {
+        average = (profileCount[probe] == 0) ? 0 :
+                (unsigned int)(profileTotal[probe] / profileCount[probe]);
+        H1_serial_write('P');
+        H1_serial_write(probe + '0');
+        H1_serial_write(' ');
+        profile_write_value('N', profileCount[probe]);
+        profile_write_value('M', (profileCount[probe] == 0) ? 0 : profileMin[probe]);
+        profile_write_value('X', profileMax[probe]);
+        profile_write_value('A', average);
+        H1_serial_write(13);    // CR
+        H1_serial_write(10);    // LF
+    }
+    profilePaused = false;
+}
+
+#endif
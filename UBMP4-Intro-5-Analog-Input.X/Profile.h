@@ -0,0 +1,83 @@
+/*==============================================================================
+ File:  Profile.h
+ Date:  October 17, 2026
+ 
+ Cycle profiling probes and function prototypes
+ 
+ Probes time sections of code (usually whole functions) using free-running
+ TMR1, which counts instruction cycles (FOSC/4, 83.3ns at 48 MHz). The minimum,
+ maximum, total and number of calls is kept for each probe, and can be sent
+ out of H1 as text by profile_report().
+ 
+ Profiling is only compiled in when PROFILE is defined (below, or in the
+ project's XC8 compiler macros). Otherwise the PROFILE_ENTER and PROFILE_EXIT
+ macros are empty, and no profiling code or RAM is used. TMR1 wraps after
+ 65536 cycles (5.46ms), so longer sections can't be timed, and the time taken
+ by interrupts during a section is included in its time. Profiling uses TMR1,
+ so it can't be used together with H1_serial_start()/H1_serial_send().
+==============================================================================*/
+
+// Uncomment to enable profiling (or define PROFILE in the compiler macros)
+// #define PROFILE
+
+// Probe numbers - add new probes here and increase PROFILE_PROBES
+#define PROBE_ADC_READ      0   // ADC_read()
+#define PROBE_H1_WRITE      1   // H1_serial_write()
+#define PROBE_BIN_TO_DEC    2   // bin_to_dec()
+#define PROBE_BIN16_TO_ASCII 3  // bin16_to_ascii()
+#define PROBE_FILTER_AVERAGE 4  // filter_sample() moving average
+#define PROBE_FILTER_EMA    5   // filter_sample() exponential moving average
+#define PROBE_FILTER_MEDIAN 6   // filter_sample() 3 and 5 tap median
+#define PROFILE_PROBES      7
+
+#ifdef PROFILE
+
+// Start and end timing a section of code
+#define PROFILE_ENTER(probe)    profile_enter(probe)
+#define PROFILE_EXIT(probe)     profile_exit(probe)
+
+/**
+ * Function: void profile_start(void)
+ * 
+ * Clear all probe results, start TMR1 counting instruction cycles, and
+ * measure the time taken by an empty PROFILE_ENTER/PROFILE_EXIT pair so that
+ * it can be subtracted from every result.
+ */
+void profile_start(void);
+
+/**
+ * Function: void profile_enter(unsigned char probe)
+ * 
+ * Record the start time of a probe. Use the PROFILE_ENTER macro instead, so
+ * that the call is removed when profiling is disabled.
+ */
+void profile_enter(unsigned char);
+
+/**
+ * Function: void profile_exit(unsigned char probe)
+ * 
+ * Add the time since the matching profile_enter() to a probe's results. Use
+ * the PROFILE_EXIT macro instead, so that the call is removed when profiling
+ * is disabled.
+ */
+void profile_exit(unsigned char);
+
+/**
+ * Function: void profile_report(void)
+ * 
+ * Write one line of results for each probe out of H1, showing the number of
+ * calls recorded (up to 65535) and the minimum, maximum and average times in
+ * instruction cycles:
+ * 
+ * P<probe> N<calls> M<minimum> X<maximum> A<average>
+ * 
+ * Probes are paused while the report is sent.
+ */
+void profile_report(void);
+
+#else
+
+#define PROFILE_ENTER(probe)
+#define PROFILE_EXIT(probe)
+
+#endif
@@ -0,0 +1,294 @@
+/*==============================================================================
+ Library:   Sample-Stream
+ Date:      October 17, 2026
+ 
+ Framed binary sample streaming functions. Sending each 8-bit sample as three
+ ASCII digits and CR/LF takes 5 bytes, while a frame of 32 10-bit samples takes
+ 45 bytes, or about 1.4 bytes per sample. Each frame contains:
+ 
+   sequence number  1 byte, incremented for every frame to detect lost frames
+   channel ID       1 byte, set by stream_start()
+   samples          packed 10-bit samples, in groups of up to 4 samples
+   CRC-8            1 byte, CRC-8 (polynomial 0x07) of all of the bytes above
+ 
+ Each group of 4 samples is packed into 5 bytes: the low 8 bits of each of the
+ 4 samples, followed by a byte holding the upper 2 bits of the first sample in
+ bits 0-1, the second in bits 2-3, and so on. A final group of fewer than 4
+ samples has its upper bits byte directly after its low bytes.
+ 
+ The frame is then COBS (consistent overhead byte stuffing) encoded, which
+ replaces every 0 byte with the distance to the next one, and is followed by a
+ 0 byte. Since a frame can't contain a 0 byte, a receiver can always find the
+ start of the next frame, even after losing bytes or starting mid-stream. The
+ reference decoder is Host-Tools/Stream-Decode.c.
+ 
+ Compressed frames, started by stream_start_compressed(), have bit 7 of the
+ channel ID byte set, followed by a sample count byte and the first (key)
+ sample as 2 bytes, upper bits first. The rest of the samples are sent as a
+ stream of 4-bit codes, packed two per byte with the first in the upper half:
+ 
+   0x0-0x7, 0x9-0xF     change from the previous sample (-7 to +7)
+   0x8, 0x0, 3 codes    escape: a full 10-bit sample, upper bits first
+   0x8, n (1-15)        escape: n + 2 repeats of the previous sample
+ 
+ Each frame can be decoded by itself, so losing a frame only loses its own
+ samples.
+ 
+ Bytes sent per sample (including COBS encoding and delimiters), compression
+ ratio compared to packed frames, and cost per sample in host instructions
+ (x86-64, built without optimization like the project; average, and worst
+ for a sample that completes and sends a frame), measured for 2048 samples
+ by the host benchmark (make -C Host-Tools bench, Bench-Stream.c):
+ 
+   Input                   Frames      Bytes  Ratio  Instr.  Worst
+   Light (slow sine)       packed      1.406   1.00   160.1   2972
+                           compressed  0.599   2.35   131.6   2960
+   Temperature (steady)    packed      1.406   1.00   160.1   2969
+                           compressed  0.225   6.25    76.6   2564
+   Constant                compressed  0.125  11.25    61.6   1112
+   Random (full scale)     compressed  2.839   0.50   394.6   3087
+ 
+ Compression pays for inputs that change by less than 8 LSBs from one
+ sample to the next, costing less per sample as well as sending fewer
+ bytes, but doubles the size of random ones. Host instructions are not PIC
+ instruction cycles - use the MPLAB X stopwatch to measure those.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "Simple-Serial.h"   // Include serial functions used by STREAM_WRITE
+#include    "Sample-Stream.h"   // Include sample streaming functions
+
+// Frame layout
+#define STREAM_HEADER   2       // Sequence number and channel ID bytes
+#define STREAM_FRAME_MAX (STREAM_HEADER + (STREAM_SAMPLES + 3) / 4 * 5 + 1)
+
+#if STREAM_FRAME_MAX > 253
+#error STREAM_SAMPLES is too large for a single COBS block
+#endif
+
+#if STREAM_KEYFRAME_INTERVAL > 255
+#error STREAM_KEYFRAME_INTERVAL must be no larger than 255
+#endif
+
+// Compressed frame layout and codes
+#define STREAM_COMPRESSED   0b10000000  // Channel ID flag for compressed frames
+#define STREAM_C_HEADER     5           // Header, count, and key sample bytes
+#define STREAM_C_NIBBLES    ((STREAM_FRAME_MAX - STREAM_C_HEADER - 1) * 2)
+#define STREAM_ESCAPE       0x8         // Escape code (a change of -8)
+#define STREAM_RUN_MAX      17          // Longest run sent by one escape
+#define STREAM_CODE_MAX     7           // Most codes added by one sample
+
+// CRC-8 (polynomial x^8 + x^2 + x + 1) remainders for each 4-bit value, used
+// to process a byte in two table lookups instead of eight shift steps
+const unsigned char crcTable[16] = {
+    0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
+    0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d
+};
+
+unsigned char streamFrame[STREAM_FRAME_MAX];    // Frame being assembled
+unsigned char streamSequence;                   // Next frame sequence number
+unsigned char streamGroup;                      // Index of current sample group
+unsigned char streamCount;                      // Samples in the current group
+unsigned char streamSamples;                    // Samples in the current frame
+bool streamCompressed;                          // Send compressed frames
+unsigned int streamPrevious;                    // Last sample compressed
+unsigned char streamRun;                        // Repeats not yet encoded
+unsigned char streamNibbles;                    // Codes in the current frame
+
+// Start a new frame for the specified channel
+void stream_start(unsigned char channel)
+{
+    streamFrame[1] = channel;
+    streamCompressed = false;
+    streamGroup = STREAM_HEADER;
+    streamCount = 0;
+    streamSamples = 0;
+}
+
+// Start a new compressed frame for the specified channel
+void stream_start_compressed(unsigned char channel)
+{
+    stream_start(channel | STREAM_COMPRESSED);
+    streamCompressed = true;
+    streamRun = 0;
+    streamNibbles = 0;
+}
+
+// Add a 4-bit code to the compressed frame
+static void stream_put_code(unsigned char code)
+{
+    unsigned char location = STREAM_C_HEADER + (streamNibbles >> 1);
+    
+    if(streamNibbles & 0b00000001)
+    {
+        streamFrame[location] |= code;
+    }
+    else
+    {
+        streamFrame[location] = (unsigned char)(code << 4);
+    }
+    streamNibbles ++;
+}
+
+// Encode the repeats of the previous sample counted so far. Runs shorter than
+// 3 are sent as changes of 0, which take no more space than an escape.
+static void stream_put_run(void)
+{
+    if(streamRun >= 3)
+    {
+        stream_put_code(STREAM_ESCAPE);
+        stream_put_code(streamRun - 2);
+        streamRun = 0;
+    }
+    while(streamRun != 0)
+    {
+        stream_put_code(0);
+        streamRun --;
+    }
+}
+
+// Encode a sample as a change, a repeat, or an escaped full sample
+static void stream_compress_sample(unsigned int sample)
+{
+    int change;
+    
+    if(streamSamples == 0)      // The first sample is the key sample
+    {
+        streamFrame[3] = (unsigned char)(sample >> 8) & 0b00000011;
+        streamFrame[4] = (unsigned char)sample;
+    }
+    else if(sample == streamPrevious)
+    {
+        streamRun ++;
+        if(streamRun == STREAM_RUN_MAX)
+        {
+            stream_put_run();
+        }
+    }
+    else
+    {
+        stream_put_run();
+        change = (int)(sample - streamPrevious);
+        if(change >= -7 && change <= 7)
+        {
+            stream_put_code((unsigned char)change & 0x0f);
+        }
+        else
+        {
+            stream_put_code(STREAM_ESCAPE);
+            stream_put_code(0);
+            stream_put_code((unsigned char)(sample >> 8) & 0b00000011);
+            stream_put_code((unsigned char)(sample >> 4) & 0x0f);
+            stream_put_code((unsigned char)sample & 0x0f);
+        }
+    }
+    streamPrevious = sample;
+    streamSamples ++;
+    
+    // Send the frame when it reaches the keyframe interval, or when the worst
+    // case codes for a pending run and one more sample might not fit
+    if(streamSamples == STREAM_KEYFRAME_INTERVAL || streamNibbles > STREAM_C_NIBBLES - STREAM_CODE_MAX)
+    {
+        stream_flush();
+    }
+}
+
+// Pack a 10-bit sample into the current frame and send full frames
+void stream_add_sample(unsigned int sample)
+{
+    if(streamCompressed)
+    {
+        stream_compress_sample(sample);
+        return;
+    }
+    if(streamCount == 0)
+    {
+        streamFrame[streamGroup + 4] = 0;   // Clear upper bits byte of new group
+    }
+    streamFrame[streamGroup + streamCount] = (unsigned char)sample;
+    streamFrame[streamGroup + 4] |= (unsigned char)((sample >> 8) & 0b00000011) << (streamCount * 2);
+    streamCount ++;
+    streamSamples ++;
+    if(streamCount == 4)
+    {
+        streamGroup += 5;
+        streamCount = 0;
+    }
+    if(streamSamples == STREAM_SAMPLES)
+    {
+        stream_flush();
+    }
+}
+
+// Add the CRC, then COBS encode and send the current frame
+void stream_flush(void)
+{
+    unsigned char length;       // Frame length including the CRC
+    unsigned char crc = 0;
+    unsigned char block;        // Start of the current COBS block
+    unsigned char next;         // Location of the next 0 byte
+    
+    if(streamSamples == 0)
+    {
+        return;
+    }
+    
+    if(streamCompressed)
+    {
+        stream_put_run();       // Encode any repeats still being counted
+        streamFrame[2] = streamSamples;
+        length = STREAM_C_HEADER + ((streamNibbles + 1) >> 1);
+    }
+    else
+    {
+        // Move the upper bits byte of a partial group down after its low bytes
+        length = streamGroup;
+        if(streamCount != 0)
+        {
+            streamFrame[streamGroup + streamCount] = streamFrame[streamGroup + 4];
+            length = streamGroup + streamCount + 1;
+        }
+    }
+    
+    streamFrame[0] = streamSequence;
+    for(unsigned char i = 0; i != length; i++)
+    {
+        crc = crc ^ streamFrame[i];
+        crc = crcTable[crc >> 4] ^ (unsigned char)(crc << 4);
+        crc = crcTable[crc >> 4] ^ (unsigned char)(crc << 4);
+    }
+    streamFrame[length] = crc;
+    length ++;
+    
+    // COBS encode: send each run of non-zero bytes preceded by its length + 1,
+    // leaving out the 0 byte that ends it (the frame is short enough that no
+    // run needs to be split)
+    block = 0;
+    while(block <= length)
+    {
+        next = block;
+        while(next != length && streamFrame[next] != 0)
+        {
+            next ++;
+        }
+        STREAM_WRITE(next - block + 1);
+        while(block != next)
+        {
+            STREAM_WRITE(streamFrame[block]);
+            block ++;
+        }
+        block ++;               // Skip the 0 byte (or the end of the frame)
+    }
+    STREAM_WRITE(0);            // Frame delimiter
+    
+    streamSequence ++;
+    streamGroup = STREAM_HEADER;
+    streamCount = 0;
+    streamSamples = 0;
+    streamRun = 0;
+    streamNibbles = 0;
+}
@@ -0,0 +1,65 @@
+/*==============================================================================
+ File:  Sample-Stream.h
+ Date:  October 17, 2026
+ 
+ Framed binary sample streaming function prototypes
+ 
+ Function prototypes for sending 10-bit ADC samples as compact binary frames
+ instead of ASCII text. See Sample-Stream.c for the frame format.
+==============================================================================*/
+
+// Number of samples sent in each full frame (frames must be shorter than 254
+// bytes, so up to 196 samples)
+#define STREAM_SAMPLES  32
+
+// Most samples sent in each compressed frame. Every compressed frame starts
+// with a full sample (keyframe), so this sets how often a receiver that
+// joins mid-stream can start decoding (up to 255 samples).
+#define STREAM_KEYFRAME_INTERVAL 128
+
+// Serial output used to send frames. Define STREAM_WRITE in the project's
+// compiler macros to use a different output, e.g. EUSART_serial_write(data).
+#ifndef STREAM_WRITE
+#define STREAM_WRITE(data) H1_serial_write(data)
+#endif
+
+/**
+ * Function: void stream_start(unsigned char channel)
+ * 
+ * Discard any unsent samples and start a new frame for the specified channel
+ * ID. The channel ID is sent in every frame (e.g. use the ADC channel
+ * constant). The frame sequence number continues from the previous frame.
+ * 
+ * Example usage: stream_start(ANQ1);
+ */
+void stream_start(unsigned char);
+
+/**
+ * Function: void stream_start_compressed(unsigned char channel)
+ * 
+ * Discard any unsent samples and start sending delta and run-length compressed
+ * frames for the specified channel ID. Compression suits slowly changing
+ * inputs such as Q1 light levels and ANTIM temperature readings.
+ * 
+ * Example usage: stream_start_compressed(ANTIM);
+ */
+void stream_start_compressed(unsigned char);
+
+/**
+ * Function: void stream_add_sample(unsigned int sample)
+ * 
+ * Add a 10-bit sample to the current frame, and send the frame once it holds
+ * STREAM_SAMPLES samples (or for compressed frames, STREAM_KEYFRAME_INTERVAL
+ * samples, or as many as fit in the frame).
+ * 
+ * Example usage: stream_add_sample(ADC_read_10bit());
+ */
+void stream_add_sample(unsigned int);
+
+/**
+ * Function: void stream_flush(void)
+ * 
+ * Send the current frame now, even if it holds fewer than STREAM_SAMPLES
+ * samples. Does nothing if the frame is empty.
+ */
+void stream_flush(void);
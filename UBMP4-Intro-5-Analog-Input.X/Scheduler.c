@@ -0,0 +1,118 @@
+/*==============================================================================
+ Library:   Scheduler
+ Date:      October 17, 2026
+ 
+ Cooperative task scheduler.
+ 
+ TMR0 runs freely and every overflow adds one to the tick count, so the ticks
+ are exact without reloading the timer (writing TMR0 would clear its
+ prescaler and lose time). The interrupt handler only counts ticks, and
+ scheduler_run() compares each task's next release time with the tick count
+ using a signed difference, so the comparisons keep working when the tick
+ count wraps around.
+ 
+ Each tick runs the whole interrupt handler, checking every driver's
+ interrupt flags, which takes over 100 instruction cycles in the -O0 build.
+ That is more than 2% of a bit at any H1 rate above 4800 bps, so the
+ blocking H1_serial_write() holds off the TMR0 interrupt while it writes the
+ bits of each frame, and the tick is counted late instead.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "Scheduler.h"       // Include scheduler functions
+
+#if SCHED_TICK_CYCLES != 256 * 64
+#error SCHED_TICK_CYCLES must match the TMR0 prescaler set by scheduler_start()
+#endif
+
+// Task list
+void (*schedTask[SCHED_TASKS])(void);   // Task functions
+unsigned int schedPeriod[SCHED_TASKS];  // Ticks between releases
+unsigned int schedDue[SCHED_TASKS];     // Tick count of the next release
+unsigned char schedTasks;               // Number of tasks added
+unsigned char scheduler_overruns[SCHED_TASKS];
+
+volatile unsigned int schedTicks;       // TMR0 overflows since start
+
+// Add a task to the task list
+bool scheduler_add(void (*task)(void), unsigned int period, unsigned int phase)
+{
+    if(schedTasks == SCHED_TASKS || period == 0 || period > 32767 || phase > 32767)
+    {
+        return (false);
+    }
+    schedTask[schedTasks] = task;
+    schedPeriod[schedTasks] = period;
+    schedDue[schedTasks] = scheduler_ticks() + phase;
+    scheduler_overruns[schedTasks] = 0;
+    schedTasks ++;
+    return (true);
+}
+
+// Start TMR0 ticks
+void scheduler_start(void)
+{
+    OPTION_REG = (OPTION_REG & 0b11000000) | 0b00000101;  // TMR0 internal, 1:64
+    TMR0IF = 0;
+    TMR0IE = 1;                 // Enable the TMR0 interrupt
+    GIE = 1;                    // Enable global interrupts
+}
+
+// Run tasks as they become due
+void scheduler_run(void)
+{
+    unsigned int now;
+    
+    while(1)
+    {
+        for(unsigned char task = 0; task != schedTasks; task++)
+        {
+            now = scheduler_ticks();
+            if((int)(now - schedDue[task]) >= 0)
+            {
+                schedTask[task]();
+                
+                // Set the next release, skipping and counting any releases
+                // that have already been missed, including those missed
+                // while the task itself was running
+                now = scheduler_ticks();
+                schedDue[task] += schedPeriod[task];
+                while((int)(now - schedDue[task]) > 0)
+                {
+                    schedDue[task] += schedPeriod[task];
+                    if(scheduler_overruns[task] != 255)
+                    {
+                        scheduler_overruns[task] ++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Return the tick count. TMR0IE is cleared while the two bytes are read so
+// that the count can't change between them.
+unsigned int scheduler_ticks(void)
+{
+    unsigned int ticks;
+    bool tickInterrupt = TMR0IE;
+    
+    TMR0IE = 0;
+    ticks = schedTicks;
+    TMR0IE = tickInterrupt;
+    return (ticks);
+}
+
+// TMR0 interrupt handler. Count one tick for each TMR0 overflow.
+void scheduler_isr(void)
+{
+    if(TMR0IF && TMR0IE)
+    {
+        TMR0IF = 0;
+        schedTicks ++;
+    }
+}
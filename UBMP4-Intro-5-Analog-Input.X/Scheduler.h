@@ -0,0 +1,72 @@
+/*==============================================================================
+ File:  Scheduler.h
+ Date:  October 17, 2026
+ 
+ Cooperative task scheduler function prototypes
+ 
+ Function prototypes for running functions (tasks) at fixed periods, timed by
+ TMR0 interrupts. Each task runs to completion before the next one is started,
+ so tasks must return quickly instead of waiting in delay loops.
+==============================================================================*/
+
+// Most tasks that can be added
+#define SCHED_TASKS     8
+
+// Each tick is one TMR0 overflow using a 1:64 prescaler: 256 x 64 instruction
+// cycles, or 1.365ms at 48 MHz. SCHED_MS() converts a time in milliseconds
+// (up to 44000) into the nearest number of ticks.
+#define SCHED_TICK_CYCLES   16384
+#define SCHED_MS(ms)    ((unsigned int)(((unsigned long)(ms) * (_XTAL_FREQ / 4000) + SCHED_TICK_CYCLES / 2) / SCHED_TICK_CYCLES))
+
+// Count of releases missed by each task because a task ran too long, indexed
+// in the order the tasks were added (up to 255)
+extern unsigned char scheduler_overruns[SCHED_TASKS];
+
+/**
+ * Function: bool scheduler_add(void (*task)(void), unsigned int period,
+ *                              unsigned int phase)
+ * 
+ * Add a task function to run every period ticks (1 to 32767), first running
+ * phase ticks after scheduler_start(). Giving tasks with the same period
+ * different phases keeps them from running in the same tick. Each release is
+ * timed from the previous one, not from when the task actually ran, so task
+ * rates are exact and don't drift. Returns false if SCHED_TASKS tasks have
+ * already been added or the period is 0 or too long.
+ * 
+ * Example usage: scheduler_add(read_buttons, SCHED_MS(20), 0);
+ */
+bool scheduler_add(void (*)(void), unsigned int, unsigned int);
+
+/**
+ * Function: void scheduler_start(void)
+ * 
+ * Set TMR0 to a 1:64 prescaler and enable its interrupt to start the ticks.
+ * (Uses TMR0.)
+ */
+void scheduler_start(void);
+
+/**
+ * Function: void scheduler_run(void)
+ * 
+ * Run each task when it is due, in the order the tasks were added, and never
+ * return. If a task is more than a full period late (because other tasks,
+ * or the task itself, ran too long), the missed releases are counted in
+ * scheduler_overruns and skipped, and the task stays in its original phase.
+ * A release that is due on the tick the task finishes isn't missed, and runs
+ * straight away.
+ */
+void scheduler_run(void);
+
+/**
+ * Function: unsigned int scheduler_ticks(void)
+ * 
+ * Return the number of ticks since scheduler_start() (wraps after 65535).
+ */
+unsigned int scheduler_ticks(void);
+
+/**
+ * Function: void scheduler_isr(void)
+ * 
+ * TMR0 interrupt handler. Call from the interrupt service routine.
+ */
+void scheduler_isr(void);
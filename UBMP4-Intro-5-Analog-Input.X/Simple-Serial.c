@@ -2,14 +2,29 @@
  Library:   SimpleSerial
  Date:      December 12, 2023
  
- Simple 9600 bits-per-second (bps) serial output example function. Sets up 
- header H1 for RS-232-style serial data output and writes bits by manipulating
- the port pin in software instead of using the built-in hardware EUSART (the 
- EUSART's TX output is on a different header pin).
+ Simple serial output example function (9600 bits-per-second (bps) unless
+ H1_BAUD is changed in Simple-Serial.h). Sets up header H1 for RS-232-style
+ serial data output and writes bits by manipulating the port pin in software
+ instead of using the built-in hardware EUSART (the EUSART's TX output is on
+ a different header pin).
  
  Serial output is useful for monitoring data using a logic analyzer or by using
  an oscilloscope with a serial decode function. Serial output can also be used
  for communicating with another microcontroller, or older peripheral devices.
+ 
+ The H1_serial_start() and H1_serial_send() functions also send serial data
+ from H1, but queue bytes in a FIFO and send them one bit at a time from the
+ TMR1 interrupt, so bit timing is set by the timer and not by delay loops.
+ 
+ The H2 serial functions receive serial data on header H2. The start bit's
+ falling edge triggers the external interrupt, and TMR2 then samples the input
+ in the middle of each bit so that small differences between the transmitter's
+ and receiver's clocks are tolerated. Received bytes are stored in a FIFO.
+ 
+ The EUSART functions are an alternative to H1 serial output that use the
+ hardware EUSART instead. Bytes are queued in a FIFO and are moved into the
+ EUSART by its transmit interrupt, so writing a byte does not wait for it to
+ be sent. The EUSART TX output is on RB7, which is shared with SW5.
  =============================================================================*/
 
 #include    "xc.h"              // Microchip XC8 compiler include file
@@ -17,6 +32,154 @@
 #include    "stdbool.h"         // Include Boolean (true/false) definitions
 
 #include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "Simple-Serial.h"   // Include serial constants and functions
+#include    "Scheduler.h"       // Include the scheduler tick length
+#include    "Profile.h"         // Include profiling probes (if enabled)
+
+#if (EUSART_FIFO_SIZE & (EUSART_FIFO_SIZE - 1)) != 0 || EUSART_FIFO_SIZE > 128
+#error EUSART_FIFO_SIZE must be a power of 2 no larger than 128
+#endif
+
+// H1 bit period in instruction cycles (FOSC/4), rounded to the nearest cycle
+#define H1_BIT_CYCLES ((_XTAL_FREQ / 4 + H1_BAUD / 2) / H1_BAUD)
+
+// Instruction cycles used by H1_serial_write() outside of its bit delays.
+// Each bit is written by the same short block of single-cycle instructions
+// (no skips or branches), so these counts come from the instruction set
+// rather than from the code XC8 generates, and don't change with the data or
+// the optimization level. They are the cycles between one H1OUT write and
+// the next, not counting the delay between them:
+//   Start bit: BCF LATC,0 | BANKSEL, MOVF, XORWF, ANDLW, XORWF LATC,F
+//   Data bit:  XORWF LATC,F, LSRF | BANKSEL, MOVF, XORWF, ANDLW, XORWF LATC,F
+//   Last bit:  XORWF LATC,F, LSRF | BANKSEL, BSF LATC,0
+#define H1_START_CYCLES 5       // Start bit write to first data bit write
+#define H1_LOOP_CYCLES  6       // Data bit write to next data bit write
+#define H1_LAST_CYCLES  3       // Last data bit write to stop bit write
+
+// Every bit H1_serial_write() sends is off only by the bit period rounding
+// error, which must fit within 2% of a bit.
+#if (H1_BIT_CYCLES * H1_BAUD > _XTAL_FREQ / 4 + _XTAL_FREQ / 200) || (H1_BIT_CYCLES * H1_BAUD < _XTAL_FREQ / 4 - _XTAL_FREQ / 200)
+#error H1_BAUD cannot be produced within 2% at this clock frequency
+#endif
+
+#if H1_BIT_CYCLES <= H1_LOOP_CYCLES
+#error H1_BAUD is too fast for H1_serial_write() at this clock frequency
+#endif
+
+// H1_serial_write() holds off the scheduler tick for the start and data bits,
+// which must be shorter than a tick so that no TMR0 overflow is lost
+#if 9 * H1_BIT_CYCLES >= SCHED_TICK_CYCLES
+#error H1_BAUD is too slow for H1_serial_write() to hold off the scheduler tick
+#endif
+
+// Delays that pad each bit out to H1_BIT_CYCLES. The stop bit is padded to a
+// full bit period from its H1OUT write, so it is never shorter than a bit
+// however soon the caller writes the next byte. Cycles the caller takes
+// before the next write only add idle time between frames.
+#define H1_START_DELAY  (H1_BIT_CYCLES - H1_START_CYCLES)
+#define H1_DATA_DELAY   (H1_BIT_CYCLES - H1_LOOP_CYCLES)
+#define H1_LAST_DELAY   (H1_BIT_CYCLES - H1_LAST_CYCLES)
+#define H1_STOP_DELAY   H1_BIT_CYCLES
+
+// Bit writes for H1_serial_write(). FSR1 points to h1WriteData, whose bit 0
+// is the next data bit. A data bit flips H1OUT (LATC bit 0) only if it
+// differs from the bit, using a single XORWF so that an interrupt can't
+// change the other LATC bits between reading and writing them.
+#ifdef __XC8
+#define H1_WRITE_POINT()    asm("MOVLW low(_h1WriteData)"); asm("MOVWF FSR1L"); \
+                            asm("MOVLW high(_h1WriteData)"); asm("MOVWF FSR1H")
+#define H1_WRITE_START()    asm("BANKSEL LATC"); asm("BCF LATC & 0x7F, 0")
+#define H1_WRITE_DATA()     asm("BANKSEL LATC"); asm("MOVF LATC & 0x7F, w"); \
+                            asm("XORWF INDF1, w"); asm("ANDLW 0x01"); \
+                            asm("XORWF LATC & 0x7F, f"); asm("LSRF INDF1, f")
+#define H1_WRITE_STOP()     asm("BANKSEL LATC"); asm("BSF LATC & 0x7F, 0")
+#else
+// The host simulator can't run PIC instructions, so the same cycles are
+// taken with NOP()s, writing H1OUT in the same cycle of each block.
+#define H1_WRITE_POINT()
+#define H1_WRITE_START()    NOP(); H1OUT = 0
+#define H1_WRITE_DATA()     NOP(); NOP(); NOP(); NOP(); \
+                            H1OUT = h1WriteData & 1; h1WriteData >>= 1; NOP()
+#define H1_WRITE_STOP()     NOP(); H1OUT = 1
+#endif
+
+unsigned char h1WriteData;                  // Data bits left to write
+
+#if (H1_FIFO_SIZE & (H1_FIFO_SIZE - 1)) != 0 || H1_FIFO_SIZE > 128
+#error H1_FIFO_SIZE must be a power of 2 no larger than 128
+#endif
+
+// H1 transmit bit timing. TMR1 counts instruction cycles (FOSC/4) and is
+// reloaded by adding to it, so the cycles taken to respond to the interrupt
+// are kept and the bit period does not drift. The timer is stopped for a few
+// cycles while the reload value is added, which H1_TMR1_STOP_CYCLES corrects.
+#define H1_TMR1_STOP_CYCLES 4
+#define H1_TMR1_RELOAD ((unsigned int)(65536 - H1_BIT_CYCLES + H1_TMR1_STOP_CYCLES))
+
+// H1 transmit FIFO. The head index is only written by H1_serial_send() and
+// the tail index is only written by H1_serial_isr().
+unsigned char h1Fifo[H1_FIFO_SIZE];         // Bytes waiting to be transmitted
+volatile unsigned char h1Head;              // Next FIFO location to write
+volatile unsigned char h1Tail;              // Next FIFO location to send
+unsigned int h1Frame;                       // Bits of the frame being sent
+unsigned char h1Bits;                       // Frame bits left to send
+
+// H2 receive bit timing. TMR2 uses the smallest prescaler that fits one bit
+// period into PR2. The first period is half a bit, shortened by the cycles
+// taken to respond to the start bit interrupt, so that it ends in the middle
+// of the start bit.
+#define H2_BIT_CYCLES ((_XTAL_FREQ / 4 + H2_BAUD / 2) / H2_BAUD)
+#define H2_INT_LATENCY_CYCLES 12
+
+#if H2_BIT_CYCLES <= 256
+#define H2_T2CKPS   0           // 1:1 prescaler
+#elif H2_BIT_CYCLES <= 1024
+#define H2_T2CKPS   1           // 1:4 prescaler
+#elif H2_BIT_CYCLES <= 4096
+#define H2_T2CKPS   2           // 1:16 prescaler
+#elif H2_BIT_CYCLES <= 16384
+#define H2_T2CKPS   3           // 1:64 prescaler
+#else
+#error H2_BAUD is too slow for TMR2
+#endif
+
+#define H2_T2_DIV       (1 << (H2_T2CKPS * 2))
+#define H2_BIT_PR2      ((H2_BIT_CYCLES + H2_T2_DIV / 2) / H2_T2_DIV - 1)
+#define H2_START_PR2    ((H2_BIT_CYCLES / 2 - H2_INT_LATENCY_CYCLES + H2_T2_DIV / 2) / H2_T2_DIV - 1)
+
+#if ((H2_BIT_PR2 + 1) * H2_T2_DIV * H2_BAUD > _XTAL_FREQ / 4 + _XTAL_FREQ / 200) || ((H2_BIT_PR2 + 1) * H2_T2_DIV * H2_BAUD < _XTAL_FREQ / 4 - _XTAL_FREQ / 200)
+#error H2_BAUD cannot be produced within 2% at this clock frequency
+#endif
+
+#if H2_BIT_CYCLES / 2 <= H2_INT_LATENCY_CYCLES + H2_T2_DIV
+#error H2_BAUD is too fast for H2 serial input at this clock frequency
+#endif
+
+#if (H2_FIFO_SIZE & (H2_FIFO_SIZE - 1)) != 0 || H2_FIFO_SIZE > 128
+#error H2_FIFO_SIZE must be a power of 2 no larger than 128
+#endif
+
+// H2 receive FIFO. The head index is only written by H2_serial_isr() and the
+// tail index is only written by H2_serial_read().
+unsigned char h2Fifo[H2_FIFO_SIZE];         // Received bytes
+volatile unsigned char h2Head;              // Next FIFO location to write
+volatile unsigned char h2Tail;              // Next FIFO location to read
+volatile bool h2Receiving;                  // True while a frame is sampled
+unsigned char h2Shift;                      // Data bits received so far
+unsigned char h2Bit;                        // Bit being sampled, 0 = start bit
+volatile unsigned char H2_rx_framing_errors; // Bytes without a valid stop bit
+volatile unsigned char H2_rx_overflows;     // Bytes discarded by a full FIFO
+
+// EUSART baud rate generator value for 16-bit, high speed (BRGH) operation
+#define EUSART_SPBRG ((_XTAL_FREQ / 4 + EUSART_BAUD / 2) / EUSART_BAUD - 1)
+
+// EUSART transmit FIFO. The head index is only written by EUSART_serial_write()
+// and the tail index is only written by EUSART_isr().
+unsigned char txFifo[EUSART_FIFO_SIZE];     // Bytes waiting to be transmitted
+volatile unsigned char txHead;              // Next FIFO location to write
+volatile unsigned char txTail;              // Next FIFO location to send
+volatile unsigned char EUSART_tx_overflows; // Bytes discarded by a full FIFO
+volatile unsigned char EUSART_tx_peak;      // Highest number of bytes queued
 
 // Configure H1 for serial output and set output pin high for idle state
 void H1_serial_config(void)
@@ -25,30 +188,279 @@ void H1_serial_config(void)
     H1OUT = 1;
 }
 
-// Write one byte of 9600,8,N,1 serial data (9600 bps, 8 data bits, no parity,
-// and 1 stop bit) to H1
+// Write one byte of H1_BAUD,8,N,1 serial data (e.g. 9600 bps, 8 data bits, no
+// parity, and 1 stop bit) to H1. The 8 data bits are unrolled so that every
+// bit takes the same number of cycles. The scheduler's TMR0 tick interrupt,
+// which runs the whole interrupt handler, is held off until the stop bit so
+// that it can't stretch a bit. A tick that comes due is handled late, not
+// lost, since TMR0IF stays set.
 void H1_serial_write(unsigned char data)
 {
+    bool tickInterrupt = TMR0IE;
+    
+    PROFILE_ENTER(PROBE_H1_WRITE);
+    TMR0IE = 0;
+    h1WriteData = data;
+    H1_WRITE_POINT();           // Point FSR1 at the data bits
+    
     // Write the Start bit (0)
-    H1OUT = 0;
-    __delay_us(104);    // Delay for 1 bit time (equal to 1/9600 s)
+    H1_WRITE_START();
+    _delay(H1_START_DELAY);     // Delay for 1 bit time (equal to 1/H1_BAUD s)
+    
+    // Shift 8 data bits out LSB first, each delay shortened by the cycles
+    // used to write the bit
+    H1_WRITE_DATA();
+    _delay(H1_DATA_DELAY);
+    H1_WRITE_DATA();
+    _delay(H1_DATA_DELAY);
+    H1_WRITE_DATA();
+    _delay(H1_DATA_DELAY);
+    H1_WRITE_DATA();
+    _delay(H1_DATA_DELAY);
+    H1_WRITE_DATA();
+    _delay(H1_DATA_DELAY);
+    H1_WRITE_DATA();
+    _delay(H1_DATA_DELAY);
+    H1_WRITE_DATA();
+    _delay(H1_DATA_DELAY);
+    H1_WRITE_DATA();
+    _delay(H1_LAST_DELAY);
     
-    // Shift 8 data bits out LSB first
-    for(unsigned char bits = 8; bits != 0; bits--)
+    // Finish the transmission by writing a Stop bit (1 - same as the idle state)
+    H1_WRITE_STOP();
+    TMR0IE = tickInterrupt;     // A late tick only lengthens the stop bit
+    _delay(H1_STOP_DELAY);
+    PROFILE_EXIT(PROBE_H1_WRITE);
+}
+
+// Configure H1 for interrupt-driven serial output and prepare TMR1
+void H1_serial_start(void)
+{
+    H1OUT = 1;                  // Idle state is high
+    TRISCbits.TRISC0 = 0;       // Make H1 an output
+    T1CON = 0b00000000;         // TMR1 off, FOSC/4 clock, 1:1 prescaler
+    T1GCON = 0b00000000;        // TMR1 gate disabled
+    h1Bits = 0;
+    TMR1IE = 0;                 // Transmit interrupt is enabled by sends
+    PEIE = 1;                   // Enable peripheral interrupts
+    GIE = 1;                    // Enable global interrupts
+}
+
+// Queue one byte for transmission on H1 without waiting
+bool H1_serial_send(unsigned char data)
+{
+    if((unsigned char)(h1Head - h1Tail) == H1_FIFO_SIZE)
+    {
+        return (false);         // FIFO is full
+    }
+    h1Fifo[h1Head & (H1_FIFO_SIZE - 1)] = data;
+    h1Head ++;                  // Publish the byte only after it is stored
+    
+    // Start the bit timer if the transmitter is idle. H1_serial_isr() only
+    // stops the timer when the FIFO is empty, so it can't stop it after the
+    // byte above has been queued.
+    if(!TMR1IE)
     {
-        if((data & 0b00000001) == 0)    // Check the least significant bit state
+        TMR1 = 0xFFFF;          // Overflow (and send the start bit) right away
+        TMR1IF = 0;
+        TMR1IE = 1;
+        TMR1ON = 1;
+    }
+    return (true);
+}
+
+// Return the number of bytes waiting in the H1 transmit FIFO
+unsigned char H1_serial_pending(void)
+{
+    return ((unsigned char)(h1Head - h1Tail));
+}
+
+// Send the next bit every time TMR1 overflows. The pin is written first so
+// that each edge follows the timer overflow by the same number of cycles.
+void H1_serial_isr(void)
+{
+    if(TMR1IF && TMR1IE)
+    {
+        if(h1Bits != 0)
+        {
+            H1OUT = (h1Frame & 0b00000001); // Output the next frame bit
+            h1Frame = h1Frame >> 1;
+            h1Bits --;
+        }
+        else if(h1Head != h1Tail)
         {
-            H1OUT = 0;
+            H1OUT = 0;          // Start bit of the next queued byte
+            h1Frame = (unsigned int)h1Fifo[h1Tail & (H1_FIFO_SIZE - 1)] | 0x0100;
+            h1Tail ++;
+            h1Bits = 9;         // 8 data bits (LSB first) and a stop bit
         }
         else
         {
-            H1OUT = 1;
+            TMR1ON = 0;         // Stop bit has been sent and FIFO is empty
+            TMR1IE = 0;
+            TMR1IF = 0;
+            return;
         }
-        __delay_us(103);    // Shorter delay to account for 'for' loop overhead
-        data = data >> 1;   // Prepare next bit by shifting data right 1 bit
+        TMR1ON = 0;             // Reload TMR1 for the next bit period
+        TMR1 += H1_TMR1_RELOAD;
+        TMR1ON = 1;
+        TMR1IF = 0;
     }
+}
+
+// Configure H2 for interrupt-driven serial input
+void H2_serial_start(void)
+{
+    TRISCbits.TRISC1 = 1;       // Make H2 a digital input
+    ANSELCbits.ANSC1 = 0;
+    TMR2ON = 0;
+    TMR2IE = 0;
+    T2CON = H2_T2CKPS;          // TMR2 off, 1:1 postscaler, bit timing prescaler
+    h2Receiving = false;
+    INTEDG = 0;                 // Interrupt on the falling edge of a start bit
+    INTF = 0;
+    INTE = 1;
+    PEIE = 1;                   // Enable peripheral interrupts
+    GIE = 1;                    // Enable global interrupts
+}
+
+// Return the number of received bytes waiting in the H2 receive FIFO
+unsigned char H2_serial_available(void)
+{
+    return ((unsigned char)(h2Head - h2Tail));
+}
+
+// Remove and return the oldest received byte from the H2 receive FIFO
+unsigned char H2_serial_read(void)
+{
+    unsigned char data;
     
-    // Finish the transmission by writing a Stop bit (1 - same as the idle state)
-    H1OUT = 1;
-    __delay_us(104);
+    if(h2Head == h2Tail)        // Return 0 if no bytes are available
+    {
+        return (0);
+    }
+    data = h2Fifo[h2Tail & (H2_FIFO_SIZE - 1)];
+    h2Tail ++;                  // Free the location only after reading it
+    return (data);
+}
+
+// Start timing a frame on each start bit edge, then sample the middle of the
+// start bit, the 8 data bits (LSB first) and the stop bit from TMR2.
+void H2_serial_isr(void)
+{
+    if(INTF && INTE)
+    {
+        TMR2 = 0;               // Time half a bit from the start bit edge
+        PR2 = H2_START_PR2;
+        TMR2ON = 1;
+        INTE = 0;               // Ignore data bit edges until the stop bit
+        INTF = 0;
+        h2Bit = 0;
+        h2Receiving = true;
+        TMR2IF = 0;
+        TMR2IE = 1;
+    }
+    if(TMR2IF && TMR2IE && h2Receiving)
+    {
+        TMR2IF = 0;
+        if(h2Bit == 0)
+        {
+            if(H2IN)            // Start bit has ended early, so it was noise
+            {
+                h2Receiving = false;
+            }
+            PR2 = H2_BIT_PR2;   // Next sample is in the middle of data bit 0
+        }
+        else if(h2Bit < 9)
+        {
+            h2Shift = h2Shift >> 1; // Assemble data bits LSB first
+            if(H2IN)
+            {
+                h2Shift = h2Shift | 0b10000000;
+            }
+        }
+        else
+        {
+            if(!H2IN)           // Stop bit must be high
+            {
+                H2_rx_framing_errors ++;
+            }
+            else if((unsigned char)(h2Head - h2Tail) == H2_FIFO_SIZE)
+            {
+                H2_rx_overflows ++;
+            }
+            else
+            {
+                h2Fifo[h2Head & (H2_FIFO_SIZE - 1)] = h2Shift;
+                h2Head ++;      // Publish the byte only after it is stored
+            }
+            h2Receiving = false;
+        }
+        h2Bit ++;
+        if(!h2Receiving)
+        {
+            TMR2ON = 0;         // Frame done, wait for the next start bit
+            TMR2IE = 0;
+            INTF = 0;
+            INTE = 1;
+        }
+    }
+}
+
+// Configure the EUSART for EUSART_BAUD,8,N,1 asynchronous serial output
+void EUSART_serial_config(void)
+{
+    BAUDCON = 0b00001000;       // Idle high TX output, 16-bit baud rate generator
+    SPBRGH = (unsigned char)(EUSART_SPBRG >> 8);
+    SPBRGL = (unsigned char)EUSART_SPBRG;
+    TXSTA = 0b00100100;         // 8-bit asynchronous transmit, high speed (BRGH)
+    RCSTA = 0b10000000;         // Enable serial port, receiver off
+    TXIE = 0;                   // Transmit interrupt is enabled by writes
+    PEIE = 1;                   // Enable peripheral interrupts
+    GIE = 1;                    // Enable global interrupts
+}
+
+// Queue one byte for transmission by the EUSART without waiting
+bool EUSART_serial_write(unsigned char data)
+{
+    unsigned char queued = (unsigned char)(txHead - txTail);
+    
+    if(queued == EUSART_FIFO_SIZE)
+    {
+        EUSART_tx_overflows ++; // FIFO is full, discard the byte
+        return (false);
+    }
+    txFifo[txHead & (EUSART_FIFO_SIZE - 1)] = data;
+    txHead ++;                  // Publish the byte only after it is stored
+    queued ++;
+    if(queued > EUSART_tx_peak)
+    {
+        EUSART_tx_peak = queued;
+    }
+    TXIE = 1;                   // Let EUSART_isr() send it when TXREG is empty
+    return (true);
+}
+
+// Return the number of bytes waiting in the transmit FIFO
+unsigned char EUSART_serial_pending(void)
+{
+    return ((unsigned char)(txHead - txTail));
+}
+
+// Move the next queued byte into TXREG, and disable the transmit interrupt
+// when the FIFO is empty (TXIF stays set while TXREG is empty)
+void EUSART_isr(void)
+{
+    if(TXIF && TXIE)
+    {
+        if(txHead != txTail)
+        {
+            TXREG = txFifo[txTail & (EUSART_FIFO_SIZE - 1)];
+            txTail ++;
+        }
+        if(txHead == txTail)
+        {
+            TXIE = 0;
+        }
+    }
 }
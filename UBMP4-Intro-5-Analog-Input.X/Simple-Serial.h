@@ -9,6 +9,15 @@
  decoding or a serial terminal program.
 ==============================================================================*/
 
+// H1 serial bit rate (bits per second). Override by defining H1_BAUD in the
+// project's compiler macros, e.g. H1_BAUD=115200. Rates that H1_serial_write()
+// can't time within 2% at _XTAL_FREQ stop the build with an error (every
+// standard rate from 9600 to 921600 can be timed at 48 MHz). Slower rates also
+// stop the build, since each frame must be shorter than a scheduler tick.
+#ifndef H1_BAUD
+#define H1_BAUD 9600
+#endif
+
 /** ** *
  * Function: void H1_serial_config(void)
  * 
@@ -19,6 +28,142 @@ void H1_serial_config(void);
 /**
  * Function: void H1_serial_write(unsigned char)
  * 
- * Write one byte of serial data out to header H1.
+ * Write one byte of H1_BAUD,8,N,1 serial data out to header H1. The TMR0
+ * interrupt is held off until the stop bit, but other interrupts still
+ * lengthen any bit they interrupt.
  */
 void H1_serial_write(unsigned char);
+
+// H1 interrupt-driven transmit FIFO size (a power of 2, up to 128 bytes)
+#define H1_FIFO_SIZE 32
+
+/**
+ * Function: void H1_serial_start(void)
+ * 
+ * Configure H1 for interrupt-driven serial output, set the output pin high
+ * (idle state), and prepare TMR1 to time each bit. (Uses TMR1.)
+ */
+void H1_serial_start(void);
+
+/**
+ * Function: bool H1_serial_send(unsigned char)
+ * 
+ * Queue one byte of H1_BAUD,8,N,1 serial data to be sent out of header H1 by
+ * H1_serial_isr() and return without waiting. Returns false if the transmit
+ * FIFO is full.
+ */
+bool H1_serial_send(unsigned char);
+
+/**
+ * Function: unsigned char H1_serial_pending(void)
+ * 
+ * Return the number of bytes waiting in the H1 transmit FIFO, not including
+ * the byte currently being sent.
+ */
+unsigned char H1_serial_pending(void);
+
+/**
+ * Function: void H1_serial_isr(void)
+ * 
+ * H1 transmit bit timer (TMR1) interrupt handler. Sends one bit every bit
+ * period. Call it first in the program's interrupt service routine, since any
+ * handler that runs before it delays the bit edges.
+ */
+void H1_serial_isr(void);
+
+// H2 serial receive bit rate (bits per second), the same as H1 by default
+#ifndef H2_BAUD
+#define H2_BAUD H1_BAUD
+#endif
+
+// H2 receive FIFO size (must be a power of 2, no larger than 128 bytes)
+#define H2_FIFO_SIZE 16
+
+// H2 receive error counters
+extern volatile unsigned char H2_rx_framing_errors; // Bytes without a valid stop bit
+extern volatile unsigned char H2_rx_overflows;      // Bytes discarded by a full FIFO
+
+/**
+ * Function: void H2_serial_start(void)
+ * 
+ * Configure header H2 for interrupt-driven H2_BAUD,8,N,1 serial input. The
+ * falling edge of each start bit is detected by the external interrupt (INT)
+ * on H2, and TMR2 then times a sample in the middle of every bit. Received
+ * bytes are stored in a FIFO. Interrupt latency uses up more of each bit at
+ * higher rates, so H2_BAUD should be no faster than 57600 for reliable input.
+ * (Uses INT and TMR2, so it can't be used at the same time as ADC timed
+ * sampling or scans.)
+ */
+void H2_serial_start(void);
+
+/**
+ * Function: unsigned char H2_serial_available(void)
+ * 
+ * Return the number of received bytes waiting in the H2 receive FIFO.
+ * 
+ * Example usage: if(H2_serial_available() != 0)
+ */
+unsigned char H2_serial_available(void);
+
+/**
+ * Function: unsigned char H2_serial_read(void)
+ * 
+ * Remove and return the oldest received byte from the H2 receive FIFO. Check
+ * H2_serial_available() first - returns 0 if the FIFO is empty.
+ * 
+ * Example usage: command = H2_serial_read();
+ */
+unsigned char H2_serial_read(void);
+
+/**
+ * Function: void H2_serial_isr(void)
+ * 
+ * H2 start bit (INT) and bit timer (TMR2) interrupt handler. Call it from the
+ * program's interrupt service routine, ahead of any handlers other than
+ * H1_serial_isr().
+ */
+void H2_serial_isr(void);
+
+// EUSART transmit FIFO size (must be a power of 2, no larger than 128 bytes)
+#define EUSART_FIFO_SIZE 32
+
+// EUSART bit rate (bits per second)
+#ifndef EUSART_BAUD
+#define EUSART_BAUD 9600
+#endif
+
+// EUSART transmit FIFO statistics, used to size EUSART_FIFO_SIZE under load
+extern volatile unsigned char EUSART_tx_overflows; // Bytes discarded by a full FIFO
+extern volatile unsigned char EUSART_tx_peak;      // Highest number of bytes queued
+
+/**
+ * Function: void EUSART_serial_config(void)
+ * 
+ * Configure the hardware EUSART for EUSART_BAUD,8,N,1 serial output on the
+ * TX pin (RB7, shared with pushbutton SW5) and enable the transmit interrupt.
+ */
+void EUSART_serial_config(void);
+
+/**
+ * Function: bool EUSART_serial_write(unsigned char)
+ * 
+ * Queue one byte of serial data for transmission by the EUSART and return
+ * without waiting. Returns false, and counts an overflow, if the transmit
+ * FIFO is full.
+ */
+bool EUSART_serial_write(unsigned char);
+
+/**
+ * Function: unsigned char EUSART_serial_pending(void)
+ * 
+ * Return the number of bytes waiting in the transmit FIFO.
+ */
+unsigned char EUSART_serial_pending(void);
+
+/**
+ * Function: void EUSART_isr(void)
+ * 
+ * EUSART transmit interrupt handler. Call from the program's interrupt service
+ * routine. Moves the next queued byte into TXREG whenever TXREG is empty.
+ */
+void EUSART_isr(void);
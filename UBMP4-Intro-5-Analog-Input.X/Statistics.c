@@ -0,0 +1,213 @@
+/*==============================================================================
+ Library:   Statistics
+ Date:      October 17, 2026
+ 
+ Streaming statistics functions.
+ 
+ Each sample only adds to running sums, using no division, so samples can be
+ added quickly at high sample rates. The sums are kept of the differences
+ between each sample and the first sample in the window (shifted data),
+ which keeps the sums small and avoids the large rounding errors of the
+ usual sum of squares method when the variance is small compared to the
+ mean. The mean and variance are only calculated when a window is complete:
+ 
+   mean     = first + sum / n
+   variance = sum of squares / n - (sum / n)^2
+ 
+ using 4 fraction bits for each value, so the two divisions don't need more
+ than 32 bits.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "Simple-Serial.h"   // Include serial functions used by STATS_WRITE
+#include    "Bin-Dec.h"         // Include binary to decimal conversion
+#include    "Statistics.h"      // Include statistics functions
+
+// ASCII character code definitions
+#define LF      10              // ASCII line feed character code
+#define CR      13              // ASCII carriage return character code
+
+// Statistics channel settings and running sums
+unsigned int statsWindow[STATS_CHANNELS];   // Samples in each window
+unsigned int statsCount[STATS_CHANNELS];    // Samples in this window so far
+unsigned int statsFirst[STATS_CHANNELS];    // First sample of this window
+unsigned int statsMinimum[STATS_CHANNELS];  // Smallest sample so far
+unsigned int statsMaximum[STATS_CHANNELS];  // Largest sample so far
+signed long statsSum[STATS_CHANNELS];       // Sum of sample - first
+unsigned long statsSquares[STATS_CHANNELS]; // Sum of (sample - first)^2
+
+// Summaries of the last full windows
+stats_summary_t statsSummaries[STATS_CHANNELS];
+bool statsReady[STATS_CHANNELS];            // Summary holds a full window
+
+// Summary line being sent. Lines longer than the output's FIFO are queued a
+// part at a time by stats_flush(), so sending never waits.
+unsigned char statsLine[STATS_LINE_SIZE];   // Summary line text
+unsigned char statsLineLength;              // Characters in the line
+unsigned char statsLineSent;                // Characters queued so far
+
+// Start a new window
+static void stats_start_window(unsigned char channel)
+{
+    statsCount[channel] = 0;
+    statsSum[channel] = 0;
+    statsSquares[channel] = 0;
+}
+
+// Set the window size of a statistics channel
+bool stats_config(unsigned char channel, unsigned int window)
+{
+    if(channel >= STATS_CHANNELS || window < 2 || window > STATS_MAX_WINDOW)
+    {
+        return (false);
+    }
+    statsWindow[channel] = window;
+    statsReady[channel] = false;
+    stats_start_window(channel);
+    return (true);
+}
+
+// Work out the summary of a full window
+static void stats_finish_window(unsigned char channel)
+{
+    stats_summary_t *summary = &statsSummaries[channel];
+    unsigned int n = statsCount[channel];
+    signed long sum = statsSum[channel];
+    signed long mean;           // Mean of the differences x 16
+    unsigned long squares;      // Mean of the squared differences x 16
+    signed long variance;
+    
+    // Round the mean of the differences to the nearest 1/16
+    if(sum >= 0)
+    {
+        mean = (sum * 16 + n / 2) / n;
+    }
+    else
+    {
+        mean = -((-sum * 16 + n / 2) / n);
+    }
+    
+    // Divide in two steps so that the sum of squares x 16 isn't needed
+    squares = (statsSquares[channel] / n) * 16 + ((statsSquares[channel] % n) * 16) / n;
+    variance = (signed long)squares - (mean * mean) / 16;
+    
+    summary->count = n;
+    summary->minimum = statsMinimum[channel];
+    summary->maximum = statsMaximum[channel];
+    summary->mean = (unsigned int)((signed long)statsFirst[channel] * 16 + mean);
+    if(variance < 0)
+    {
+        summary->variance = 0;  // Rounding can make a tiny variance negative
+    }
+    else if(variance > 65535)
+    {
+        summary->variance = 65535;
+    }
+    else
+    {
+        summary->variance = (unsigned int)variance;
+    }
+    statsReady[channel] = true;
+}
+
+// Add a sample to a statistics channel's window
+bool stats_sample(unsigned char channel, unsigned int sample)
+{
+    signed int difference;
+    unsigned int magnitude;
+    
+    if(channel >= STATS_CHANNELS || statsWindow[channel] == 0)
+    {
+        return (false);         // Channel not set by stats_config()
+    }
+    if(statsCount[channel] == 0)
+    {
+        statsFirst[channel] = sample;
+        statsMinimum[channel] = sample;
+        statsMaximum[channel] = sample;
+    }
+    else if(sample < statsMinimum[channel])
+    {
+        statsMinimum[channel] = sample;
+    }
+    else if(sample > statsMaximum[channel])
+    {
+        statsMaximum[channel] = sample;
+    }
+    
+    difference = (signed int)(sample - statsFirst[channel]);
+    magnitude = (difference < 0) ? (unsigned int)-difference : (unsigned int)difference;
+    statsSum[channel] += difference;
+    statsSquares[channel] += (unsigned long)magnitude * magnitude;
+    statsCount[channel] ++;
+    
+    if(statsCount[channel] >= statsWindow[channel])
+    {
+        stats_finish_window(channel);
+        stats_start_window(channel);
+        return (true);
+    }
+    return (false);
+}
+
+// Copy the summary of the last full window
+bool stats_summary(unsigned char channel, stats_summary_t *summary)
+{
+    if(channel >= STATS_CHANNELS || !statsReady[channel])
+    {
+        return (false);
+    }
+    *summary = statsSummaries[channel];
+    return (true);
+}
+
+// Add one value to the summary line as a letter followed by 5 decimal digits
+static void stats_line_value(unsigned char letter, unsigned int value)
+{
+    statsLine[statsLineLength++] = ' ';
+    statsLine[statsLineLength++] = letter;
+    bin16_to_ascii(value, &statsLine[statsLineLength]);
+    statsLineLength += 5;
+}
+
+// Start sending the summary of the last full window as one line
+bool stats_send(unsigned char channel)
+{
+    stats_summary_t *summary;
+    
+    if(channel >= STATS_CHANNELS || !statsReady[channel] || statsLineSent != statsLineLength)
+    {
+        return (false);
+    }
+    summary = &statsSummaries[channel];
+    statsLineLength = 0;
+    statsLineSent = 0;
+    statsLine[statsLineLength++] = 'S';
+    statsLine[statsLineLength++] = '0' + channel;
+    stats_line_value('N', summary->count);
+    stats_line_value('L', summary->minimum);
+    stats_line_value('H', summary->maximum);
+    stats_line_value('M', summary->mean);
+    stats_line_value('V', summary->variance);
+    statsLine[statsLineLength++] = CR;
+    statsLine[statsLineLength++] = LF;
+    stats_flush();
+    return (true);
+}
+
+// Queue the rest of the summary line
+bool stats_flush(void)
+{
+    while(statsLineSent != statsLineLength)
+    {
+        if(!STATS_WRITE(statsLine[statsLineSent]))
+        {
+            return (false);     // Output is full, try again later
+        }
+        statsLineSent ++;
+    }
+    return (true);
+}
@@ -0,0 +1,99 @@
+/*==============================================================================
+ File:  Statistics.h
+ Date:  October 17, 2026
+ 
+ Streaming statistics function prototypes
+ 
+ Function prototypes for summarizing analog input samples on the device.
+ Each statistics channel collects the count, minimum, maximum, mean and
+ variance of the samples in a window of a set number of samples, then
+ starts a new window, so long-term monitoring can send one small summary
+ per window instead of every sample (e.g. one summary per second of 1000
+ samples/s timed sampling).
+==============================================================================*/
+
+// Number of statistics channels
+#define STATS_CHANNELS      4
+
+// Largest window (in samples) that can't overflow the 32-bit sum of squares
+// of 10-bit samples
+#define STATS_MAX_WINDOW    4000
+
+// Serial output used by stats_send() and stats_flush(). STATS_WRITE must
+// queue one byte without waiting and return false if there is no room, like
+// H1_serial_send() (call H1_serial_start() first). Define STATS_WRITE in the
+// project's compiler macros to use a different output, e.g.
+// EUSART_serial_write(data).
+#ifndef STATS_WRITE
+#define STATS_WRITE(data) H1_serial_send(data)
+#endif
+
+// Length of a summary line sent by stats_send()
+#define STATS_LINE_SIZE     39
+
+// Summary of one window of samples
+typedef struct
+{
+    unsigned int count;         // Number of samples
+    unsigned int minimum;       // Smallest sample
+    unsigned int maximum;       // Largest sample
+    unsigned int mean;          // Mean x 16 (4 fraction bits)
+    unsigned int variance;      // Variance x 16, limited to 65535 (a standard
+                                // deviation of 64 10-bit steps)
+} stats_summary_t;
+
+/**
+ * Function: bool stats_config(unsigned char channel, unsigned int window)
+ * 
+ * Set the number of samples in each window of a statistics channel (0 to
+ * STATS_CHANNELS - 1), from 2 to STATS_MAX_WINDOW, and start a new window.
+ * Returns false if the channel or window size is out of range.
+ * 
+ * Example usage: stats_config(0, 1000);
+ */
+bool stats_config(unsigned char, unsigned int);
+
+/**
+ * Function: bool stats_sample(unsigned char channel, unsigned int sample)
+ * 
+ * Add an 8 or 10-bit sample to a statistics channel's window. When the
+ * window is full, its summary is saved for stats_summary() and stats_send(),
+ * a new window is started, and true is returned. Samples for a channel that
+ * is out of range or hasn't been set by stats_config() are ignored.
+ * 
+ * Example usage: if(stats_sample(0, ADC_read_10bit()))
+ */
+bool stats_sample(unsigned char, unsigned int);
+
+/**
+ * Function: bool stats_summary(unsigned char channel, stats_summary_t *summary)
+ * 
+ * Copy the summary of a statistics channel's last full window into summary.
+ * Returns false if the channel is out of range or no window has been
+ * completed since stats_config().
+ */
+bool stats_summary(unsigned char, stats_summary_t *);
+
+/**
+ * Function: bool stats_send(unsigned char channel)
+ * 
+ * Send the summary of a statistics channel's last full window using
+ * STATS_WRITE as one line, e.g. "S0 N01000 L00123 H00140 M02096 V00021" for
+ * 1000 samples from 123 to 140 with a mean of 131.0 (2096 / 16) and a
+ * variance of 1.31 (21 / 16). As much of the line as fits is queued without
+ * waiting, and stats_flush() queues the rest. Returns false, sending nothing,
+ * if the channel is out of range, no window has been completed, or the
+ * previous line hasn't all been queued yet.
+ * 
+ * Example usage: stats_send(0);
+ */
+bool stats_send(unsigned char);
+
+/**
+ * Function: bool stats_flush(void)
+ * 
+ * Queue as much of the rest of the summary line started by stats_send() as
+ * STATS_WRITE has room for. Call regularly (e.g. from a scheduler task).
+ * Returns true once the whole line has been queued.
+ */
+bool stats_flush(void);
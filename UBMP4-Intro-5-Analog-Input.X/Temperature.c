@@ -0,0 +1,310 @@
+/*==============================================================================
+ Library:   Temperature
+ Date:      October 17, 2026
+ 
+ Calibrated on-die temperature functions.
+ 
+ In its high range, the temperature indicator's output is Vdd - 4Vt, where Vt
+ is the voltage across a diode that falls by about 1.32mV per degree (AN1333).
+ Measured against Vdd, the 12-bit ADC code rises by about 4.3 codes per degree.
+ The lookup table holds the typical code at every 10 degrees from -40 to 120
+ degrees for a 5V supply, along with the slope of each segment in tenths of a
+ degree per code (x256), so a reading is converted by finding its segment and
+ multiplying its distance from the start of the segment by the slope.
+ 
+ Parts differ from the typical diode voltage by several degrees, and the
+ supply voltage changes the codes, so a calibration is applied to each code
+ before it is looked up: corrected = (code x gain) / 4096 + offset. A single-
+ point calibration only sets the offset, while a two-point calibration sets
+ both. The table can be replaced with values characterized for a particular
+ board without changing the conversion.
+ 
+ XC8's long multiply routine stops as soon as the bits of its multiplier run
+ out, so its time depends on the values. The conversion uses its own 16 x 16
+ bit shift-and-add multiply instead, which always makes exactly 16 passes and
+ selects each partial product with a mask rather than a branch. Together with
+ the fixed 4-step table search, every code takes the same path through the
+ conversion.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "Temperature.h"     // Include temperature functions
+
+#if TEMP_TABLE_SEGMENTS != 16
+#error TEMP_TABLE_SEGMENTS must be 16
+#endif
+#if TEMP_HEF_ADDRESS != 0x1F80
+#error TEMP_HEF_ADDRESS must match the row reserved by the ROM ranges option
+#endif
+
+// Typical 12-bit ANTIM codes at each table temperature (Vdd = 5V,
+// Vt = 0.659V - 1.32mV x (T + 40))
+const unsigned int tempCodes[TEMP_TABLE_SEGMENTS + 1] = {
+    1937, 1980, 2023, 2066, 2110, 2153, 2196, 2239, 2283,
+    2326, 2369, 2412, 2456, 2499, 2542, 2585, 2629
+};
+
+// Slope of each table segment, in tenths of a degree per code x 256
+// (100 x 256 / (tempCodes[n + 1] - tempCodes[n]))
+const unsigned int tempSlope[TEMP_TABLE_SEGMENTS] = {
+    595, 595, 595, 582, 595, 595, 595, 582,
+    595, 595, 595, 582, 595, 595, 595, 582
+};
+
+// Calibration, as a 4.12 fixed point gain and an offset in codes
+#define TEMP_UNITY_GAIN 4096        // Gain of 1.0
+#define TEMP_MIN_GAIN   2048        // Gain of 0.5
+#define TEMP_MAX_GAIN   8192        // Gain of 2.0
+#define TEMP_MAX_OFFSET 512         // Largest offset correction (about 120 C)
+#define TEMP_MIN_SPAN   200         // Two-point calibration span (20.0 C)
+
+unsigned int tempGain = TEMP_UNITY_GAIN;
+int tempOffset = 0;
+
+// Calibration record stored in HEF, one byte in each flash word
+#define TEMP_HEF_MARKER 0xA5        // Marks a saved calibration
+#define TEMP_HEF_BYTES  6           // Marker, gain (2), offset (2), checksum
+#define TEMP_HEF_ROW    32          // Flash row size in words
+
+// The HEF row (TEMP_HEF_ADDRESS to TEMP_HEF_ADDRESS + TEMP_HEF_ROW - 1) is
+// kept free of code by the project's ROM ranges option (-mrom=default,-0-7FF,
+// -1F80-1F9F), which excludes it along with the bootloader. Each saved word
+// holds a RETLW instruction (0x34xx). Programming the microcontroller erases
+// the saved calibration, and an erased row (0x3FFF) has no valid marker.
+
+// Read the low byte of a word in the HEF row
+static unsigned char hef_read(unsigned char offset)
+{
+    PMADRH = (unsigned char)(TEMP_HEF_ADDRESS >> 8);
+    PMADRL = (unsigned char)TEMP_HEF_ADDRESS + offset;
+    CFGS = 0;                   // Select program memory
+    RD = 1;                     // Start the read
+    NOP();                      // The two instructions after RD = 1 are
+    NOP();                      // ignored while the word is read
+    return (PMDATL);
+}
+
+// Send the flash unlock sequence and start an erase or write. The CPU stops
+// until the erase or write has finished.
+static void flash_unlock(void)
+{
+    PMCON2 = 0x55;
+    PMCON2 = 0xAA;
+    WR = 1;
+    NOP();
+    NOP();
+}
+
+// Load the saved calibration, or the uncalibrated values
+void temperature_config(void)
+{
+    unsigned char record[TEMP_HEF_BYTES];
+    unsigned char sum = 0;
+    
+    // Enable the temperature indicator and set the high operating Vdd range
+    FVRCON = FVRCON | 0b00110000;
+    
+    for(unsigned char i = 0; i != TEMP_HEF_BYTES; i++)
+    {
+        record[i] = hef_read(i);
+        sum += record[i];
+    }
+    temperature_clear_calibration();
+    if(record[0] == TEMP_HEF_MARKER && sum == 0)
+    {
+        tempGain = ((unsigned int)record[2] << 8) | record[1];
+        tempOffset = (int)(((unsigned int)record[4] << 8) | record[3]);
+    }
+}
+
+// Read a 12-bit oversampled temperature indicator code
+unsigned int temperature_read_code(void)
+{
+    ADC_select_channel(ANTIM);
+    __delay_us(ADC_TEMP_ACQUISITION);   // Let the indicator settle on the hold cap.
+    return (ADC_read_oversampled(12));
+}
+
+// Multiply two 16-bit values in exactly 16 shift-and-add passes. Each pass
+// adds multiplicand or 0, selected by masking with the multiplier's top bit.
+static unsigned long temp_multiply(unsigned int multiplicand, unsigned int multiplier)
+{
+    unsigned long product = 0;
+    
+    for(unsigned char i = 0; i != 16; i++)
+    {
+        product <<= 1;
+        product += multiplicand & (unsigned int)(0 - ((multiplier >> 15) & 1));
+        multiplier <<= 1;
+    }
+    return (product);
+}
+
+// Convert a 12-bit temperature indicator code into tenths of a degree
+int temperature_convert(unsigned int code)
+{
+    long corrected;
+    unsigned char segment = 0;
+    
+    // Apply the calibration, then keep the code in the 12-bit range
+    corrected = (long)(temp_multiply(code, tempGain) >> 12) + tempOffset;
+    if(corrected < 0)
+    {
+        corrected = 0;
+    }
+    if(corrected > 4095)
+    {
+        corrected = 4095;
+    }
+    
+    // Binary search for the segment, always taking 4 steps. Codes outside the
+    // table use the first or last segment, extending its slope.
+    if(corrected >= tempCodes[segment + 8])
+    {
+        segment += 8;
+    }
+    if(corrected >= tempCodes[segment + 4])
+    {
+        segment += 4;
+    }
+    if(corrected >= tempCodes[segment + 2])
+    {
+        segment += 2;
+    }
+    if(corrected >= tempCodes[segment + 1])
+    {
+        segment += 1;
+    }
+    
+    // Interpolate within the segment. Codes below the table make the
+    // distance negative, so 4096 codes are added to keep the unsigned
+    // multiply in range, and 4096 x slope / 256 is taken off afterwards.
+    return ((TEMP_TABLE_MIN + segment * TEMP_TABLE_STEP) * 10
+            + (int)(temp_multiply((unsigned int)(corrected - tempCodes[segment] + 4096), tempSlope[segment]) >> 8)
+            - (int)(tempSlope[segment] << 4));
+}
+
+// Read the temperature in tenths of a degree
+int temperature_read(void)
+{
+    return (temperature_convert(temperature_read_code()));
+}
+
+// Return the typical (uncalibrated) code for a temperature in tenths of a
+// degree. Only used for calibration, so it can use division.
+static int temperature_code(int tenths)
+{
+    int position = tenths - TEMP_TABLE_MIN * 10;    // Tenths above the table
+    unsigned char segment;
+    
+    if(position < 0)
+    {
+        segment = 0;
+    }
+    else if(position >= TEMP_TABLE_SEGMENTS * TEMP_TABLE_STEP * 10)
+    {
+        segment = TEMP_TABLE_SEGMENTS - 1;
+    }
+    else
+    {
+        segment = (unsigned char)(position / (TEMP_TABLE_STEP * 10));
+    }
+    position -= segment * TEMP_TABLE_STEP * 10;
+    return ((int)tempCodes[segment] + (int)((long)position
+            * (tempCodes[segment + 1] - tempCodes[segment]) / (TEMP_TABLE_STEP * 10)));
+}
+
+// Set the offset from a code read at a known temperature
+bool temperature_calibrate(unsigned int code, int tenths)
+{
+    int offset = temperature_code(tenths)
+            - (int)(((unsigned long)code * tempGain) >> 12);
+    
+    if(offset > TEMP_MAX_OFFSET || offset < -TEMP_MAX_OFFSET)
+    {
+        return (false);
+    }
+    tempOffset = offset;
+    return (true);
+}
+
+// Set the gain and offset from codes read at two known temperatures
+bool temperature_calibrate_2point(unsigned int code1, int tenths1, unsigned int code2, int tenths2)
+{
+    long gain;
+    int span = tenths2 - tenths1;
+    
+    if(span < TEMP_MIN_SPAN && span > -TEMP_MIN_SPAN)
+    {
+        return (false);
+    }
+    if(code1 == code2)
+    {
+        return (false);
+    }
+    gain = ((long)(temperature_code(tenths2) - temperature_code(tenths1)) << 12)
+            / ((long)code2 - (long)code1);
+    if(gain < TEMP_MIN_GAIN || gain > TEMP_MAX_GAIN)
+    {
+        return (false);
+    }
+    tempGain = (unsigned int)gain;
+    if(!temperature_calibrate(code1, tenths1))
+    {
+        temperature_clear_calibration();
+        return (false);
+    }
+    return (true);
+}
+
+// Write the calibration into HEF
+void temperature_save_calibration(void)
+{
+    unsigned char record[TEMP_HEF_BYTES];
+    bool globalInterrupts = GIE;
+    
+    record[0] = TEMP_HEF_MARKER;
+    record[1] = (unsigned char)tempGain;
+    record[2] = (unsigned char)(tempGain >> 8);
+    record[3] = (unsigned char)tempOffset;
+    record[4] = (unsigned char)((unsigned int)tempOffset >> 8);
+    record[5] = 0 - (unsigned char)(record[0] + record[1] + record[2] + record[3] + record[4]);
+    
+    GIE = 0;                    // The unlock sequence must not be interrupted
+    
+    // Erase the row
+    PMADRH = (unsigned char)(TEMP_HEF_ADDRESS >> 8);
+    PMADRL = (unsigned char)TEMP_HEF_ADDRESS;
+    CFGS = 0;                   // Select program memory
+    FREE = 1;                   // Erase
+    WREN = 1;                   // Enable flash writes
+    flash_unlock();
+    
+    // Load the write latches, and write the row with the last word
+    FREE = 0;
+    LWLO = 1;                   // Only load the write latches
+    for(unsigned char i = 0; i != TEMP_HEF_BYTES; i++)
+    {
+        PMADRL = (unsigned char)TEMP_HEF_ADDRESS + i;
+        PMDATH = 0x34;          // RETLW instruction
+        PMDATL = record[i];
+        if(i == TEMP_HEF_BYTES - 1)
+        {
+            LWLO = 0;           // Write the latches into flash
+        }
+        flash_unlock();
+    }
+    WREN = 0;                   // Disable flash writes
+    GIE = globalInterrupts;
+}
+
+// Return to the uncalibrated lookup table values
+void temperature_clear_calibration(void)
+{
+    tempGain = TEMP_UNITY_GAIN;
+    tempOffset = 0;
+}
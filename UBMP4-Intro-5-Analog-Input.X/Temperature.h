@@ -0,0 +1,107 @@
+/*==============================================================================
+ File:  Temperature.h
+ Date:  October 17, 2026
+ 
+ Calibrated on-die temperature function prototypes
+ 
+ Function prototypes for reading the PIC16F1459 on-die temperature indicator
+ (ANTIM) in tenths of a degree Celsius, using an interpolated lookup table and
+ a single-point or two-point calibration stored in high-endurance flash (HEF).
+ All of the conversions use integer math, so the XC8 floating point library
+ is not needed.
+==============================================================================*/
+
+// Temperature lookup table range and step, in degrees Celsius
+#define TEMP_TABLE_MIN  -40
+#define TEMP_TABLE_STEP 10
+#define TEMP_TABLE_SEGMENTS 16      // Must be 16 (4 search steps)
+
+// High-endurance flash row used to store the calibration. The HEF is the last
+// 128 words of program memory, and the calibration uses the first 32 word row,
+// which the project's ROM ranges (-mrom=default,-0-7FF,-1F80-1F9F) reserve.
+#define TEMP_HEF_ADDRESS 0x1F80
+
+/**
+ * Function: void temperature_config(void)
+ * 
+ * Enable the temperature indicator in its high operating Vdd range and load
+ * the calibration stored in HEF, or the uncalibrated defaults if none has been
+ * saved. Uses the ADC, so call ADC_config() first.
+ */
+void temperature_config(void);
+
+/**
+ * Function: unsigned int temperature_read_code(void)
+ * 
+ * Switch the ADC to ANTIM, wait for the acquisition time, and return a 12-bit
+ * oversampled temperature indicator code (16 conversions). Leaves the ADC
+ * switched to ANTIM.
+ * 
+ * Example usage: code = temperature_read_code();
+ */
+unsigned int temperature_read_code(void);
+
+/**
+ * Function: int temperature_convert(unsigned int code)
+ * 
+ * Convert a 12-bit temperature indicator code into tenths of a degree Celsius
+ * using the current calibration. The conversion takes constant time: each
+ * one uses the same 4 table search steps and two fixed 16-pass multiplies,
+ * and no division or floating point.
+ * 
+ * Example usage: tenths = temperature_convert(code);   // 235 = 23.5 C
+ */
+int temperature_convert(unsigned int);
+
+/**
+ * Function: int temperature_read(void)
+ * 
+ * Read the temperature indicator and return the temperature in tenths of a
+ * degree Celsius.
+ * 
+ * Example usage: tenths = temperature_read();
+ */
+int temperature_read(void);
+
+/**
+ * Function: bool temperature_calibrate(unsigned int code, int tenths)
+ * 
+ * Single-point calibration. Adjust the offset so that a code read by
+ * temperature_read_code() converts to the known temperature (in tenths of a
+ * degree). The current gain is kept. Returns false if the correction is too
+ * large to be a valid reading. Call temperature_save_calibration() to keep it.
+ * 
+ * Example usage: temperature_calibrate(temperature_read_code(), 220);
+ */
+bool temperature_calibrate(unsigned int, int);
+
+/**
+ * Function: bool temperature_calibrate_2point(unsigned int code1, int tenths1,
+ *                                             unsigned int code2, int tenths2)
+ * 
+ * Two-point calibration. Set the gain and offset from codes read at two known
+ * temperatures, which corrects for both the part's diode voltage and the
+ * supply voltage. The temperatures should be at least 20 degrees apart.
+ * Returns false if the calibration is not valid.
+ * 
+ * Example usage: temperature_calibrate_2point(coldCode, 50, hotCode, 600);
+ */
+bool temperature_calibrate_2point(unsigned int, int, unsigned int, int);
+
+/**
+ * Function: void temperature_save_calibration(void)
+ * 
+ * Write the current calibration into HEF so that it is loaded by
+ * temperature_config() after each reset. Interrupts are disabled while the
+ * flash row is erased and written (about 4ms), and the CPU stops during each
+ * step. Re-programming the microcontroller erases the saved calibration.
+ */
+void temperature_save_calibration(void);
+
+/**
+ * Function: void temperature_clear_calibration(void)
+ * 
+ * Return to the uncalibrated lookup table values. Call
+ * temperature_save_calibration() to also clear the saved calibration.
+ */
+void temperature_clear_calibration(void);
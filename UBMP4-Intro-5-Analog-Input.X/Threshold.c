@@ -0,0 +1,154 @@
+/*==============================================================================
+ Library:   Threshold
+ Date:      October 17, 2026
+ 
+ Threshold detection with hysteresis and debouncing.
+ 
+ Each channel is either low or high. A low channel only looks for samples at
+ or above its rising level, and a high channel only looks for samples at or
+ below its falling level, so a noisy input hovering near one level can't
+ cause repeated changes. The debounce count adds a second layer of noise
+ rejection by requiring several samples in a row past the level.
+ 
+ Event times are each channel's count of samples (wrapping at 65535), so with
+ timed sampling the time between events is the difference in counts divided
+ by the sample rate.
+ 
+ The event queue's indexes are volatile so that threshold_update() can be
+ called from an interrupt handler while the main loop removes events. Each
+ side only writes its own index, and the event is stored before the head is
+ advanced, so no interrupts need to be disabled.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "Simple-Serial.h"   // Include serial functions used by THRESHOLD_WRITE
+#include    "Bin-Dec.h"         // Include binary to decimal conversion
+#include    "Threshold.h"       // Include threshold detection functions
+
+#if (THRESHOLD_EVENTS & (THRESHOLD_EVENTS - 1)) != 0 || THRESHOLD_EVENTS > 128
+#error THRESHOLD_EVENTS must be a power of 2 no larger than 128
+#endif
+
+// ASCII character code definitions
+#define LF      10              // ASCII line feed character code
+#define CR      13              // ASCII carriage return character code
+
+// Threshold channel settings and state
+unsigned int thresholdRising[THRESHOLD_CHANNELS];   // Rising level
+unsigned int thresholdFalling[THRESHOLD_CHANNELS];  // Falling level
+unsigned int thresholdTime[THRESHOLD_CHANNELS];     // Sample count
+unsigned char thresholdDebounce[THRESHOLD_CHANNELS];    // Samples required
+unsigned char thresholdCount[THRESHOLD_CHANNELS];   // Samples past the level
+bool thresholdHigh[THRESHOLD_CHANNELS];             // Current state
+bool thresholdStarted[THRESHOLD_CHANNELS];          // False until first sample
+
+// Event queue
+threshold_event_t thresholdEvents[THRESHOLD_EVENTS];
+volatile unsigned char thresholdHead;   // Next event location to write
+volatile unsigned char thresholdTail;   // Next event location to read
+volatile unsigned char threshold_overflows;
+
+// Set the levels of a threshold channel and reset it
+void threshold_config(unsigned char channel, unsigned int rising, unsigned int falling, unsigned char debounce)
+{
+    thresholdRising[channel] = rising;
+    thresholdFalling[channel] = falling;
+    thresholdDebounce[channel] = (debounce == 0) ? 1 : debounce;
+    thresholdCount[channel] = 0;
+    thresholdTime[channel] = 0;
+    thresholdStarted[channel] = false;
+}
+
+// Check a new sample against a threshold channel's levels
+unsigned char threshold_update(unsigned char channel, unsigned int sample)
+{
+    unsigned char direction = THRESHOLD_NONE;
+    unsigned int time = thresholdTime[channel]++;
+    
+    // Set the starting state from the first sample
+    if(!thresholdStarted[channel])
+    {
+        thresholdHigh[channel] = (sample >= thresholdRising[channel]);
+        thresholdStarted[channel] = true;
+        return (THRESHOLD_NONE);
+    }
+    
+    // Count samples past the level for the current state, starting the count
+    // over if the input goes back inside the hysteresis gap
+    if(thresholdHigh[channel] ? sample <= thresholdFalling[channel] : sample >= thresholdRising[channel])
+    {
+        thresholdCount[channel] ++;
+        if(thresholdCount[channel] >= thresholdDebounce[channel])
+        {
+            thresholdHigh[channel] = !thresholdHigh[channel];
+            thresholdCount[channel] = 0;
+            direction = (thresholdHigh[channel]) ? THRESHOLD_RISING : THRESHOLD_FALLING;
+        }
+    }
+    else
+    {
+        thresholdCount[channel] = 0;
+    }
+    
+    // Queue the event, or count it as lost if the queue is full
+    if(direction != THRESHOLD_NONE)
+    {
+        if((unsigned char)(thresholdHead - thresholdTail) == THRESHOLD_EVENTS)
+        {
+            threshold_overflows ++;
+        }
+        else
+        {
+            threshold_event_t *event = &thresholdEvents[thresholdHead & (THRESHOLD_EVENTS - 1)];
+            event->channel = channel;
+            event->direction = direction;
+            event->time = time;
+            thresholdHead ++;
+        }
+    }
+    return (direction);
+}
+
+// Return true if a threshold channel is high
+bool threshold_state(unsigned char channel)
+{
+    return (thresholdHigh[channel]);
+}
+
+// Remove the oldest queued event
+bool threshold_get_event(threshold_event_t *event)
+{
+    if(thresholdHead == thresholdTail)
+    {
+        return (false);
+    }
+    *event = thresholdEvents[thresholdTail & (THRESHOLD_EVENTS - 1)];
+    thresholdTail ++;
+    return (true);
+}
+
+// Send all queued events, one line per event
+void threshold_send_events(void)
+{
+    threshold_event_t event;
+    unsigned char digits[5];
+    
+    while(threshold_get_event(&event))
+    {
+        THRESHOLD_WRITE('T');
+        THRESHOLD_WRITE('0' + event.channel);
+        THRESHOLD_WRITE(' ');
+        THRESHOLD_WRITE((event.direction == THRESHOLD_RISING) ? 'R' : 'F');
+        THRESHOLD_WRITE(' ');
+        bin16_to_ascii(event.time, digits);
+        for(unsigned char i = 0; i != 5; i++)
+        {
+            THRESHOLD_WRITE(digits[i]);
+        }
+        THRESHOLD_WRITE(CR);
+        THRESHOLD_WRITE(LF);
+    }
+}
@@ -0,0 +1,91 @@
+/*==============================================================================
+ File:  Threshold.h
+ Date:  October 17, 2026
+ 
+ Threshold detection function prototypes
+ 
+ Function prototypes for detecting when analog inputs cross bright and dark
+ (or hot and cold) levels with hysteresis and debouncing. Only the changes of
+ state are reported, so a program can watch several inputs and send a few
+ bytes when something happens instead of streaming every sample.
+==============================================================================*/
+
+// Number of threshold channels, and number of events that can be queued
+#define THRESHOLD_CHANNELS  4
+#define THRESHOLD_EVENTS    8   // Must be a power of 2, no larger than 128
+
+// Threshold states and events
+#define THRESHOLD_NONE      0   // No change of state
+#define THRESHOLD_RISING    1   // Input rose to the rising level (now high)
+#define THRESHOLD_FALLING   2   // Input fell to the falling level (now low)
+
+// Serial output used by threshold_send_events(). Define THRESHOLD_WRITE in the
+// project's compiler macros to use a different output.
+#ifndef THRESHOLD_WRITE
+#define THRESHOLD_WRITE(data) H1_serial_write(data)
+#endif
+
+// Threshold event, queued for each change of state
+typedef struct
+{
+    unsigned char channel;      // Threshold channel
+    unsigned char direction;    // THRESHOLD_RISING or THRESHOLD_FALLING
+    unsigned int time;          // Channel's sample count at the change
+} threshold_event_t;
+
+// Count of events lost because the event queue was full
+extern volatile unsigned char threshold_overflows;
+
+/**
+ * Function: void threshold_config(unsigned char channel, unsigned int rising,
+ *                                 unsigned int falling, unsigned char debounce)
+ * 
+ * Set the levels of a threshold channel (0 to THRESHOLD_CHANNELS - 1) and
+ * reset it. The channel changes to high after debounce samples in a row are at
+ * or above the rising level, and changes to low after debounce samples in a
+ * row are at or below the falling level. The rising level should be above the
+ * falling level, and the gap between them sets the amount of hysteresis.
+ * The first sample sets the starting state without an event.
+ * 
+ * Example usage: threshold_config(0, 140, 120, 3);
+ */
+void threshold_config(unsigned char, unsigned int, unsigned int, unsigned char);
+
+/**
+ * Function: unsigned char threshold_update(unsigned char channel,
+ *                                          unsigned int sample)
+ * 
+ * Check a new sample (8 or 10 bits, matching the configured levels) against a
+ * threshold channel's levels. Returns THRESHOLD_RISING or THRESHOLD_FALLING
+ * if the channel changed state, and also queues the event, or returns
+ * THRESHOLD_NONE.
+ * 
+ * Example usage: if(threshold_update(0, ADC_read()) == THRESHOLD_RISING)
+ */
+unsigned char threshold_update(unsigned char, unsigned int);
+
+/**
+ * Function: bool threshold_state(unsigned char channel)
+ * 
+ * Return true if a threshold channel is currently high.
+ */
+bool threshold_state(unsigned char);
+
+/**
+ * Function: bool threshold_get_event(threshold_event_t *event)
+ * 
+ * Remove the oldest queued event and copy it into event. Returns false if no
+ * events are waiting.
+ */
+bool threshold_get_event(threshold_event_t *);
+
+/**
+ * Function: void threshold_send_events(void)
+ * 
+ * Send all queued events using THRESHOLD_WRITE, one line per event, e.g.
+ * "T0 R 01234" for channel 0 rising at sample 1234, or "T0 F 01302" when it
+ * falls again.
+ * 
+ * Example usage: threshold_send_events();
+ */
+void threshold_send_events(void);
@@ -0,0 +1,129 @@
+/*==============================================================================
+ Library:   Tone
+ Date:      October 17, 2026
+ 
+ Timer-generated tone functions.
+ 
+ TMR1 counts instruction cycles (FOSC/4, 12 MHz) and interrupts when it
+ overflows. Each interrupt toggles the beeper and adds the reload value for
+ the current note to TMR1, so the time taken to respond to the interrupt
+ doesn't change the pitch. The note is a single byte, so it can be changed
+ at any time without disabling interrupts, and the new half-period is used
+ from the next toggle.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "Tone.h"            // Include tone functions
+
+// TMR1 is stopped for this many cycles while the reload value is added
+#define TONE_TMR1_STOP_CYCLES   4
+
+// Half-periods of each note in instruction cycles (6 MHz / frequency)
+const unsigned int toneHalfPeriods[TONE_NOTES] = {
+    54545, 51484, 48594, 45867, 43293, 40863,   // A2 - D3#
+    38569, 36405, 34361, 32433, 30613, 28894,   // E3 - G3#
+    27273, 25742, 24297, 22934, 21646, 20431,   // A3 - D4#
+    19285, 18202, 17181, 16216, 15306, 14447,   // E4 - G4#
+    13636, 12871, 12149, 11467, 10823, 10216,   // A4 - D5#
+    9642, 9101, 8590, 8108, 7653, 7224,         // E5 - G5#
+    6818, 6436, 6074, 5733, 5412, 5108,         // A5 - D6#
+    4821, 4551, 4295, 4054, 3827, 3612,         // E6 - G6#
+    3409                                        // A6
+};
+
+// Silent periods are timed using the A4 half-period
+#define TONE_SILENT_PERIOD      13636
+
+volatile unsigned char toneNote = TONE_OFF; // Note being played
+bool toneRunning;                           // TMR1 is timing the tone
+
+// Prepare TMR1 and the beeper
+void tone_start(void)
+{
+    toneNote = TONE_OFF;
+    toneRunning = false;        // Pause the handler while starting
+    BEEPER = 0;
+    T1GCON = 0b00000000;        // TMR1 gate disabled
+    T1CON = 0b00000000;         // TMR1 off, FOSC/4 clock, 1:1 prescaler
+    TMR1 = (unsigned int)(65536 - TONE_SILENT_PERIOD);
+    TMR1IF = 0;
+    TMR1IE = 1;
+    PEIE = 1;
+    GIE = 1;
+    toneRunning = true;
+    TMR1ON = 1;
+}
+
+// Stop the tone
+void tone_stop(void)
+{
+    TMR1ON = 0;
+    TMR1IE = 0;
+    TMR1IF = 0;
+    toneRunning = false;
+    toneNote = TONE_OFF;
+    BEEPER = 0;
+}
+
+// Set the note
+void tone_set_note(unsigned char note)
+{
+    if(note >= TONE_NOTES)
+    {
+        note = TONE_OFF;
+    }
+    toneNote = note;
+}
+
+// Set the note from an 8-bit ADC result
+unsigned char tone_follow(unsigned char sample)
+{
+    // Input position in 1/256 note steps (note number in the upper byte)
+    unsigned int position = (unsigned int)sample * TONE_NOTES;
+    unsigned char note = toneNote;
+    
+    if(note >= TONE_NOTES)
+    {
+        note = (unsigned char)(position >> 8);  // Start from the nearest note
+    }
+    else if(position + TONE_HYSTERESIS < ((unsigned int)note << 8))
+    {
+        note = (unsigned char)((position + TONE_HYSTERESIS) >> 8);
+    }
+    else if(position >= ((unsigned int)(note + 1) << 8) + TONE_HYSTERESIS)
+    {
+        note = (unsigned char)((position - TONE_HYSTERESIS) >> 8);
+    }
+    toneNote = note;
+    return (note);
+}
+
+// Toggle the beeper every half cycle. TMR1 interrupts are left to the other
+// TMR1 users unless tone_start() has been called.
+void tone_isr(void)
+{
+    if(TMR1IF && TMR1IE && toneRunning)
+    {
+        unsigned char note = toneNote;
+        unsigned int halfPeriod;
+        
+        if(note < TONE_NOTES)
+        {
+            BEEPER = !BEEPER;
+            halfPeriod = toneHalfPeriods[note];
+        }
+        else
+        {
+            BEEPER = 0;         // Silent, but keep the timer running
+            halfPeriod = TONE_SILENT_PERIOD;
+        }
+        TMR1ON = 0;             // Reload TMR1 for the next half cycle
+        TMR1 += (unsigned int)(65536 - halfPeriod + TONE_TMR1_STOP_CYCLES);
+        TMR1ON = 1;
+        TMR1IF = 0;
+    }
+}
@@ -0,0 +1,69 @@
+/*==============================================================================
+ File:  Tone.h
+ Date:  October 17, 2026
+ 
+ Timer-generated tone function prototypes
+ 
+ Function prototypes for a tone generator that toggles the piezo beeper (LS1,
+ RA4) from the TMR1 interrupt. The pitch is set by a note number, looked up in
+ a table of TMR1 half-periods covering the 4 octaves from A2 (110 Hz) to A6
+ (1760 Hz) in semitones. tone_follow() sets the note from an 8-bit ADC
+ result, so the pitch can track an analog input while the rest of the
+ program keeps running.
+ 
+ The tone uses TMR1, so it can't be used together with H1_serial_start()/
+ H1_serial_send() or profiling. H1_serial_write() and the EUSART still work.
+==============================================================================*/
+
+// Tone settings
+#define TONE_NOTES      49          // Semitones from A2 to A6
+#define TONE_OFF        255         // Note number to silence the beeper
+#define TONE_HYSTERESIS 64          // Note change margin in 1/256 note steps
+
+/**
+ * Function: void tone_start(void)
+ * 
+ * Prepare TMR1 and the beeper for tone output. The beeper stays silent until
+ * a note is set.
+ */
+void tone_start(void);
+
+/**
+ * Function: void tone_stop(void)
+ * 
+ * Stop TMR1 and the tone, and turn the beeper off.
+ */
+void tone_stop(void);
+
+/**
+ * Function: void tone_set_note(unsigned char note)
+ * 
+ * Play a note from 0 (A2, 110 Hz) to TONE_NOTES - 1 (A6, 1760 Hz), or
+ * silence the beeper using TONE_OFF. The new pitch starts at the next half
+ * cycle, so changing notes doesn't cause clicks or glitches.
+ * 
+ * Example usage: tone_set_note(24);        // A4, 440 Hz
+ */
+void tone_set_note(unsigned char);
+
+/**
+ * Function: unsigned char tone_follow(unsigned char sample)
+ * 
+ * Set the note from an 8-bit ADC result, spreading the ADC range evenly over
+ * all of the notes. An input has to move TONE_HYSTERESIS/256 of a note step
+ * past the edge of the current note before the note changes, so a noisy
+ * input near an edge doesn't warble between two notes. Returns the note.
+ * 
+ * Example usage: tone_follow(ADC_read());
+ */
+unsigned char tone_follow(unsigned char);
+
+/**
+ * Function: void tone_isr(void)
+ * 
+ * Toggle the beeper and reload TMR1 for the next half cycle. Call from the
+ * interrupt service routine before H1_serial_isr(), which also uses TMR1.
+ * TMR1 interrupts are ignored until tone_start() is called, and again after
+ * tone_stop().
+ */
+void tone_isr(void);
@@ -15,13 +15,69 @@
 #include    "stdbool.h"         // Include Boolean (true/false) definitions
 
 #include    "UBMP4.h"           // Include UBMP4 constant & function definitions
+#include    "Profile.h"         // Include profiling probes (if enabled)
+
+#if (ADC_BUFFER_SIZE & (ADC_BUFFER_SIZE - 1)) != 0 || ADC_BUFFER_SIZE > 128
+#error ADC_BUFFER_SIZE must be a power of 2 no larger than 128
+#endif
+
+// ADC ring buffer. The head index is only written by ADC_isr() and the tail
+// index is only written by ADC_get_sample(), so neither needs interrupts to
+// be disabled. Both indexes run freely and are masked when used, so the
+// difference between them is the number of samples stored.
+unsigned int adcBuffer[ADC_BUFFER_SIZE];    // Stored ADRESH:ADRESL results
+volatile unsigned char adcHead;             // Next buffer location to write
+volatile unsigned char adcTail;             // Next buffer location to read
+volatile bool adcContinuous;                // Restart conversions when true
+volatile bool adcTimerStart;                // Start conversions on TMR2IF
+volatile unsigned char ADC_overruns;        // Samples lost to a full buffer
+
+// ADC scan state. Acquisition times are stored as TMR2 PR2 values using a
+// 1:16 prescaler (3 TMR2 counts for every 4 microseconds).
+#define ADC_SCAN_T2CON  0b00000010  // TMR2 off, 1:1 postscaler, 1:16 prescaler
+#define ADC_REPEAT_PR2  1           // 2.7us (2 TAD) between repeated conversions
+
+unsigned char scanChannel[ADC_SCAN_MAX];    // ADCON0 value for each entry
+unsigned char scanPeriod[ADC_SCAN_MAX];     // TMR2 acquisition period (PR2)
+unsigned char scanShift[ADC_SCAN_MAX];      // log2 of conversions averaged
+unsigned int scanResults[ADC_SCAN_MAX];     // Latest averaged results
+unsigned int scanSum;                       // Sum of the current entry's results
+unsigned char scanEntries;                  // Number of entries in the scan
+unsigned char scanIndex;                    // Entry currently being converted
+unsigned char scanConversions;              // Conversions left for this entry
+volatile bool adcScanning;                  // Scan in progress when true
+volatile bool scanRepeat;                   // Restart scan when complete
+volatile bool scanDone;                     // Set when a full scan finishes
+
+// ADC channel table, indexed by each channel constant's CHS bits. Entries for
+// channel numbers that UBMP4 doesn't use are left as 0, which can never be a
+// valid ADCON0 value since ADON is set in every entry.
+const ADC_channel_t adcChannels[32] = {
+    [AN4 >> 2]   = {AN4 | 0b00000001, ADC_PIN_PORTC, 0b00000001, ADC_PIN_ACQUISITION},   // RC0
+    [AN5 >> 2]   = {AN5 | 0b00000001, ADC_PIN_PORTC, 0b00000010, ADC_PIN_ACQUISITION},   // RC1
+    [AN6 >> 2]   = {AN6 | 0b00000001, ADC_PIN_PORTC, 0b00000100, ADC_PIN_ACQUISITION},   // RC2
+    [AN7 >> 2]   = {AN7 | 0b00000001, ADC_PIN_PORTC, 0b00001000, ADC_PIN_ACQUISITION},   // RC3
+    [AN8 >> 2]   = {AN8 | 0b00000001, ADC_PIN_PORTC, 0b01000000, ADC_PIN_ACQUISITION},   // RC6
+    [AN9 >> 2]   = {AN9 | 0b00000001, ADC_PIN_PORTC, 0b10000000, ADC_PIN_ACQUISITION},   // RC7
+    [AN10 >> 2]  = {AN10 | 0b00000001, ADC_PIN_PORTB, 0b00010000, ADC_PIN_ACQUISITION},  // RB4
+    [AN11 >> 2]  = {AN11 | 0b00000001, ADC_PIN_PORTB, 0b00100000, ADC_PIN_ACQUISITION},  // RB5
+    [ANTIM >> 2] = {ANTIM | 0b00000001, ADC_PIN_NONE, 0, ADC_TEMP_ACQUISITION}           // Temp.
+};
+
+// Stop the build if the table's channel constants aren't all valid
+ADC_CHECK_CHANNEL(ANQ1);
+ADC_CHECK_CHANNEL(ANH1);
+ADC_CHECK_CHANNEL(ANH8);
+ADC_CHECK_CHANNEL(ANTIM);
 
 // Configure oscillator for 48 MHz operation (required for USB bootloader).
 void OSC_config(void)
 {
     OSCCON = 0xFC;              // Set 16MHz HFINTOSC with 3x PLL enabled
     ACTCON = 0x90;              // Enable active clock tuning from USB clock
-    while(!PLLRDY);             // Wait for PLL lock (disable for simulation)
+#ifndef SIMULATION
+    while(!PLLRDY);             // Wait for PLL lock (simulator never sets PLLRDY)
+#endif
 }
 
 // Configure hardware ports and peripherals for on-board UBMP4 I/O devices.
@@ -61,35 +117,572 @@ void ADC_config(void)
     ADCON2 = 0b00000000;        // Auto-conversion trigger disabled
 }
 
+// Return the channel table entry for a channel constant
+#define ADC_CHANNEL(channel) (adcChannels[((channel) >> 2) & 0b00011111])
+
+// Return true if a channel is one of the UBMP4 channel constants. Any bits set
+// outside of the CHS bits would make the table look up a different channel.
+static bool ADC_valid_channel(unsigned char channel)
+{
+    return ((channel & 0b10000011) == 0 && ADC_CHANNEL(channel).adcon0 != 0);
+}
+
+// Make a channel's pin an analog input. Returns false for unknown channels.
+bool ADC_enable_input(unsigned char channel)
+{
+    const ADC_channel_t *descriptor = &ADC_CHANNEL(channel);
+    
+    if(!ADC_valid_channel(channel))
+    {
+        return (false);         // Not a UBMP4 channel
+    }
+    if(descriptor->port == ADC_PIN_PORTB)
+    {
+        TRISB = TRISB | descriptor->pin;    // Disable the pin's output driver
+        ANSELB = ANSELB | descriptor->pin;  // and enable its analog input
+    }
+    else if(descriptor->port == ADC_PIN_PORTC)
+    {
+        TRISC = TRISC | descriptor->pin;
+        ANSELC = ANSELC | descriptor->pin;
+    }
+    return (true);
+}
+
 // Enable ADC and switch ADC input mux to the specified channel (use channel
-// constants defined in UBMP420.h header file - e.g. ANQ1).
-void ADC_select_channel(unsigned char channel)
+// constants defined in UBMP4.h header file - e.g. ANQ1). The table holds the
+// complete ADCON0 value, so the channel and ADON are set by a single write.
+bool ADC_select_channel(unsigned char channel)
+{
+    if(!ADC_enable_input(channel))
+    {
+        return (false);         // Leave the ADC unchanged
+    }
+    ADCON0 = ADC_CHANNEL(channel).adcon0;
+    return (true);
+}
+
+// Return a channel's minimum acquisition time in microseconds
+unsigned char ADC_acquisition_time(unsigned char channel)
+{
+    return ((ADC_valid_channel(channel)) ? ADC_CHANNEL(channel).acquisition : 0);
+}
+
+// Wait for the acquisition time of a channel after switching to it
+static void ADC_acquire(unsigned char channel)
 {
-    ADON = 1;                   // Turn the A-D converter on
-    ADCON0 = (ADCON0 & 0b10000011); // Clear channel select (CHS) bits by ANDing
-    ADCON0 = (ADCON0 | channel);	// Set channel by ORing with channel constant
+    for(unsigned char us = ADC_CHANNEL(channel).acquisition; us != 0; us--)
+    {
+        __delay_us(1);
+    }
 }
 
 // Convert the currently selected channel and return an 8-bit conversion result.
 unsigned char ADC_read(void)
 {
+    PROFILE_ENTER(PROBE_ADC_READ);
     GO = 1;                     // Start the conversion by setting Go/~Done bit
 	while(GO)                   // Wait for the conversion to finish (GO==0)
         ;                       // Terminating loop on new line silences warning
+    PROFILE_EXIT(PROBE_ADC_READ);
     return (ADRESH);            // Return the MSB (upper 8-bits) of the result
 }
 
 // Enable ADC, switch to specified channel, and return 8-bit conversion result.
-// Use channel constants defined in UBMP420.h header file (e.g. ANQ1).
+// Use channel constants defined in UBMP420.h header file (e.g. ANQ1). Returns
+// 0 without converting if the channel is not valid, since setting GO with the
+// ADC off would wait forever.
 unsigned char ADC_read_channel(unsigned char channel)
 {
-    ADON = 1;                   // Turn the ADC on
-    ADCON0 = (ADCON0 & 0b10000011); // Clear channel select (CHS) bits by ANDing
-    ADCON0 = (ADCON0 | channel);	// Set channel by ORing with chan. constant
-    __delay_us(5);              // Allow input to settle (charges internal cap.)
+    if(!ADC_select_channel(channel))    // Turn ADC on and switch the input mux
+    {
+        return (0);
+    }
+    ADC_acquire(channel);       // Allow input to settle (charges internal cap.)
     GO = 1;                     // Start the conversion by setting Go/~Done bit
 	while(GO)                   // Wait for the conversion to finish (GO==0)
         ;                       // Terminating loop on new line silences warning
     ADON = 0;                   // Turn the ADC off
     return (ADRESH);            // Return the MSB (upper 8-bits) of the result
-}
\ No newline at end of file
+}
+
+// Convert the currently selected channel and return a 10-bit result. The ADC
+// is configured for left-justified results, so the upper 8 bits are in ADRESH
+// and the lower 2 bits are in the top of ADRESL.
+unsigned int ADC_read_10bit(void)
+{
+    GO = 1;                     // Start the conversion by setting Go/~Done bit
+	while(GO)                   // Wait for the conversion to finish (GO==0)
+        ;                       // Terminating loop on new line silences warning
+    return (((unsigned int)ADRESH << 2) | (ADRESL >> 6));
+}
+
+// Enable ADC, switch to specified channel, and return 10-bit conversion result,
+// or ADC_INVALID if the channel is not valid.
+unsigned int ADC_read_channel_10bit(unsigned char channel)
+{
+    unsigned int result;
+    
+    if(!ADC_select_channel(channel))    // Turn ADC on and switch the input mux
+    {
+        return (ADC_INVALID);
+    }
+    ADC_acquire(channel);       // Allow input to settle (charges internal cap.)
+    result = ADC_read_10bit();
+    ADON = 0;                   // Turn the ADC off
+    return (result);
+}
+
+// Convert the currently selected channel 4^(bits - 10) times and decimate the
+// sum to the requested resolution. Summing 4^n conversions adds 2n bits, and
+// shifting right by n keeps n of them, so no division is needed.
+unsigned int ADC_read_oversampled(unsigned char bits)
+{
+    unsigned int sum = 0;       // Up to 64 x 1023 fits in 16 bits
+    unsigned char extra;        // Extra bits of resolution
+    unsigned char conversions;  // 4^extra
+    
+    if(bits > ADC_OVERSAMPLE_MAX_BITS)
+    {
+        bits = ADC_OVERSAMPLE_MAX_BITS;
+    }
+    extra = (bits > 10) ? bits - 10 : 0;
+    conversions = (unsigned char)(1 << (extra * 2));
+    
+    while(conversions != 0)
+    {
+        sum += ADC_read_10bit();
+        __delay_us(3);          // Wait 2 TAD before the next acquisition
+        conversions --;
+    }
+    return (sum >> extra);
+}
+
+// Enable ADC, switch to the specified channel, and convert it while the core
+// sleeps. The FRC clock keeps running in Sleep, so the conversion is done with
+// the CPU, oscillator and PLL stopped, and ADIF wakes the core when the result
+// is ready. GIE is cleared so that waking continues after SLEEP() instead of
+// calling the interrupt handler. Any other interrupt that is enabled and
+// flagged will end Sleep early, and the conversion then finishes while awake.
+// Sleep stops the instruction clock that runs TMR0, TMR1, TMR2 and the EUSART,
+// and the USB module, so the conversion is made awake instead if any of them
+// are in use (scheduler, LED display, H1/H2 serial, tone, timed sampling, PWM,
+// EUSART output or USB). Otherwise they would stop for the whole conversion,
+// with their interrupts held off.
+unsigned int ADC_read_channel_sleep(unsigned char channel)
+{
+    unsigned char adcClock = ADCON1;    // Save the ADC clock setting
+    bool adcInterrupt = ADIE;   // Save the interrupt enable bits
+    bool peripheralInterrupts = PEIE;
+    bool globalInterrupts = GIE;
+    unsigned int result;
+    
+    if(TMR0IE || TMR1ON || TMR2ON || TXIE || USBEN)
+    {
+        return (ADC_read_channel_10bit(channel));   // Don't stop their clock
+    }
+    if(!ADC_select_channel(channel))    // Turn ADC on and switch the input mux
+    {
+        return (ADC_INVALID);
+    }
+    GIE = 0;                    // Wake up without calling the interrupt handler
+    ADCON1 = (ADCON1 & 0b10001111) | ADC_FRC_CLOCK; // Use the ADC's FRC clock
+    ADC_acquire(channel);       // Allow input to settle (charges internal cap.)
+    ADIF = 0;                   // Clear any earlier conversion-complete flag
+    ADIE = 1;                   // Enable ADIF to wake the core from Sleep
+    PEIE = 1;
+    GO = 1;                     // Start the conversion (delayed by 1 cycle for
+    SLEEP();                    // FRC so that SLEEP() runs first) and sleep
+    NOP();
+    while(GO)                   // Wait for the conversion to finish if Sleep
+        ;                       // was ended early by another interrupt
+    ADIF = 0;
+    result = ((unsigned int)ADRESH << 2) | (ADRESL >> 6);
+    ADON = 0;                   // Turn the ADC off
+    ADCON1 = adcClock;          // Restore the ADC clock and interrupt settings
+    ADIE = adcInterrupt;
+    PEIE = peripheralInterrupts;
+    GIE = globalInterrupts;
+    return (result);
+}
+
+// Convert a channel 2^samples times and return the variance of the results in
+// 1/16 LSB^2 steps. Sums are taken of each result's difference from the first
+// result, which keeps the sum of squares small for a steady input.
+unsigned int ADC_variance(unsigned char channel, unsigned char samples, bool sleep)
+{
+    unsigned char conversions;
+    unsigned int first = 0;
+    int difference;
+    long sum = 0;               // Sum of differences
+    unsigned long squares = 0;  // Sum of squared differences
+    unsigned long sumSquared;
+    
+    if(samples < ADC_VARIANCE_MIN_SAMPLES)
+    {
+        samples = ADC_VARIANCE_MIN_SAMPLES;
+    }
+    if(samples > ADC_VARIANCE_MAX_SAMPLES)
+    {
+        samples = ADC_VARIANCE_MAX_SAMPLES;
+    }
+    for(conversions = 0; conversions != (unsigned char)(1 << samples); conversions ++)
+    {
+        difference = (int)((sleep) ? ADC_read_channel_sleep(channel) : ADC_read_channel_10bit(channel));
+        if(conversions == 0)
+        {
+            first = (unsigned int)difference;
+        }
+        difference -= (int)first;
+        sum += difference;
+        squares += (unsigned long)((long)difference * difference);
+    }
+    // N x N x variance = N x (sum of squares) - sum^2, and N = 2^samples, so
+    // shifting right by 2 x samples - 4 gives the variance x 16
+    sumSquared = (unsigned long)((sum < 0) ? -sum : sum);
+    sumSquared *= sumSquared;
+    squares = ((squares << samples) - sumSquared) >> (samples * 2 - 4);
+    return ((squares > 65535) ? 65535 : (unsigned int)squares);
+}
+
+// Enable ADC, switch to the specified channel, and start interrupt-driven
+// conversions. Results are stored in the ring buffer by ADC_isr().
+void ADC_start_sampling(unsigned char channel, bool continuous)
+{
+    if(!ADC_select_channel(channel))    // Turn ADC on and switch the input mux
+    {
+        return;
+    }
+    ADC_acquire(channel);       // Allow input to settle (charges internal cap.)
+    adcContinuous = continuous; // Set conversion mode before enabling ADIF
+    ADIF = 0;                   // Clear any earlier conversion-complete flag
+    ADIE = 1;                   // Enable the ADC conversion-complete interrupt
+    PEIE = 1;                   // Enable peripheral interrupts
+    GIE = 1;                    // Enable global interrupts
+    GO = 1;                     // Start the first conversion
+}
+
+// Enable ADC, switch to the specified channel, and start interrupt-driven
+// sampling at a fixed rate timed by TMR2. Returns the actual sample rate, or 0
+// if the requested rate can't be produced.
+unsigned int ADC_start_timed_sampling(unsigned char channel, unsigned int rate)
+{
+    unsigned long counts;       // Instruction cycles (FOSC/4) per sample
+    unsigned char prescale = 0; // T2CKPS prescaler select bits (1:1 to 1:64)
+    unsigned char postscale = 1;    // TMR2 postscaler divisor (1 to 16)
+    unsigned int period;        // TMR2 counts per sample (PR2 + 1)
+    
+    if(rate < ADC_TRIGGER_MIN_RATE || rate > ADC_MAX_RATE || !ADC_valid_channel(channel))
+    {
+        return (0);
+    }
+    
+    // Find the smallest prescaler, then postscaler, that fits the sample
+    // period into the 8-bit PR2 register. Each prescaler step divides by 4.
+    counts = (_XTAL_FREQ / 4 + rate / 2) / rate;
+    while(prescale < 3 && counts > ((unsigned long)256 << (prescale * 2)))
+    {
+        prescale ++;
+    }
+    while(counts > ((unsigned long)256 * postscale << (prescale * 2)))
+    {
+        postscale ++;
+    }
+    period = (unsigned int)((counts + ((unsigned long)postscale << (prescale * 2)) / 2)
+            / ((unsigned long)postscale << (prescale * 2)));
+    
+    ADC_start_tmr2_timer(channel, (unsigned char)((postscale - 1) << 3) | prescale,
+            (unsigned char)(period - 1));
+    
+    return ((unsigned int)((_XTAL_FREQ / 4 + (((unsigned long)period * postscale << (prescale * 2)) / 2))
+            / ((unsigned long)period * postscale << (prescale * 2))));
+}
+
+// Enable ADC, switch to the specified channel, and start interrupt-driven
+// sampling timed by TMR2 with the supplied T2CON and PR2 settings. A 1:1
+// postscaler uses the ADCON2 auto-conversion trigger, others start each
+// conversion from the TMR2 interrupt.
+bool ADC_start_tmr2_timer(unsigned char channel, unsigned char t2con, unsigned char pr2)
+{
+    if(!ADC_valid_channel(channel))
+    {
+        return (false);
+    }
+    ADC_stop_sampling();        // Stop any sampling already in progress
+    ADC_select_channel(channel);    // Turn ADC on and switch the input mux
+    
+    TMR2ON = 0;                 // Stop and reset TMR2 before reconfiguring it
+    TMR2 = 0;
+    PR2 = pr2;
+    T2CON = t2con & 0b01111011; // Postscaler and prescaler, timer still off
+    
+    adcContinuous = false;      // Conversions are started by the timer
+    ADIF = 0;                   // Clear any earlier conversion-complete flag
+    TMR2IF = 0;
+    if((t2con & 0b01111000) == 0)   // 1:1 postscaler
+    {
+        adcTimerStart = false;
+        ADCON2 = 0b01010000;    // Auto-conversion trigger on TMR2 match to PR2
+    }
+    else
+    {
+        adcTimerStart = true;   // Start conversions from the TMR2 interrupt
+        TMR2IE = 1;
+    }
+    ADIE = 1;                   // Enable the ADC conversion-complete interrupt
+    PEIE = 1;                   // Enable peripheral interrupts
+    GIE = 1;                    // Enable global interrupts
+    TMR2ON = 1;                 // Start the sample timer
+    return (true);
+}
+
+// Enable ADC and start an interrupt-driven scan through a list of channels.
+bool ADC_start_scan(const ADC_scan_entry_t *list, unsigned char entries, bool continuous)
+{
+    unsigned char ticks;
+    
+    if(entries == 0 || entries > ADC_SCAN_MAX)
+    {
+        return (false);
+    }
+    
+    ADC_stop_sampling();        // Stop any sampling already in progress
+    
+    // Copy the scan list, converting acquisition times to TMR2 periods. An
+    // entry's acquisition time is never shorter than its channel's minimum.
+    for(unsigned char i = 0; i != entries; i++)
+    {
+        unsigned char acquisition = list[i].acquisition;
+        
+        if(list[i].oversample > 6)
+        {
+            return (false);
+        }
+        if(!ADC_enable_input(list[i].channel))
+        {
+            return (false);     // Not a UBMP4 channel
+        }
+        if(acquisition < ADC_CHANNEL(list[i].channel).acquisition)
+        {
+            acquisition = ADC_CHANNEL(list[i].channel).acquisition;
+        }
+        scanChannel[i] = ADC_CHANNEL(list[i].channel).adcon0;
+        scanShift[i] = list[i].oversample;
+        ticks = (unsigned char)(((unsigned int)acquisition * 3 + 3) >> 2);
+        scanPeriod[i] = (ticks == 0) ? 0 : ticks - 1;
+    }
+    scanEntries = entries;
+    scanIndex = 0;
+    scanConversions = (unsigned char)(1 << scanShift[0]);
+    scanSum = 0;
+    scanRepeat = continuous;
+    scanDone = false;
+    adcScanning = true;
+    
+    // Switch to the first channel and time its acquisition with TMR2
+    ADCON0 = scanChannel[0];
+    T2CON = ADC_SCAN_T2CON;
+    TMR2 = 0;
+    PR2 = scanPeriod[0];
+    ADIF = 0;
+    TMR2IF = 0;
+    ADIE = 1;                   // Enable the ADC conversion-complete interrupt
+    TMR2IE = 1;                 // Enable the acquisition timer interrupt
+    PEIE = 1;                   // Enable peripheral interrupts
+    GIE = 1;                    // Enable global interrupts
+    TMR2ON = 1;                 // Start acquisition timing for the first channel
+    return (true);
+}
+
+// Return true once each time a full scan has finished.
+bool ADC_scan_complete(void)
+{
+    if(scanDone)
+    {
+        scanDone = false;
+        return (true);
+    }
+    return (false);
+}
+
+// Return the latest 10-bit averaged result for a scan list entry.
+unsigned int ADC_scan_result(unsigned char entry)
+{
+    unsigned int result;
+    bool adcInterrupt = ADIE;   // Keep ADC_isr() from changing the result
+    
+    ADIE = 0;                   // while both bytes are being read
+    result = scanResults[entry];
+    ADIE = adcInterrupt;
+    return (result);
+}
+
+// Stop interrupt-driven conversions after the one in progress finishes,
+// leaving TMR2 running.
+static void ADC_stop_conversions(void)
+{
+    ADCON2 = 0b00000000;        // Disable the auto-conversion trigger
+    TMR2IE = 0;                 // Stop timed conversions from the TMR2 interrupt
+    adcTimerStart = false;
+    adcScanning = false;        // Stop scans from switching channels
+    adcContinuous = false;      // Prevent ADC_isr() from restarting the ADC
+    while(GO)                   // Wait for any conversion in progress to finish
+        ;
+    ADIE = 0;                   // Disable the ADC interrupt
+}
+
+// Stop interrupt-driven sampling after the conversion in progress finishes.
+void ADC_stop_sampling(void)
+{
+    ADC_stop_conversions();
+    TMR2ON = 0;                 // Stop the sample and acquisition timer
+}
+
+// Enable ADC, switch to the specified channel, and start interrupt-driven
+// sampling once every 'periods' periods of TMR2, without changing its PR2 or
+// prescaler (so PWM outputs keep their frequency). One period uses the TMR2
+// match auto-conversion trigger, and longer ones the TMR2 postscaler and
+// interrupt, as in ADC_start_timed_sampling().
+unsigned int ADC_start_tmr2_sampling(unsigned char channel, unsigned char periods)
+{
+    unsigned char prescale = T2CON & 0b00000011;
+    unsigned long counts;       // Instruction cycles (FOSC/4) per sample
+    
+    if(periods == 0 || periods > 16 || !TMR2ON || !ADC_valid_channel(channel))
+    {
+        return (0);
+    }
+    counts = ((unsigned long)PR2 + 1) * periods << (prescale * 2);
+    if(counts < (_XTAL_FREQ / 4) / ADC_MAX_RATE)
+    {
+        return (0);             // Faster than ADC_isr() can keep up with
+    }
+    
+    ADC_stop_conversions();     // Stop any sampling, but not TMR2
+    ADC_select_channel(channel);    // Turn ADC on and switch the input mux
+    T2CON = (unsigned char)((periods - 1) << 3) | 0b00000100 | prescale;
+    
+    adcContinuous = false;      // Conversions are started by the timer
+    ADIF = 0;                   // Clear any earlier conversion-complete flag
+    TMR2IF = 0;
+    if(periods == 1)
+    {
+        ADCON2 = 0b01010000;    // Auto-conversion trigger on TMR2 match to PR2
+    }
+    else
+    {
+        adcTimerStart = true;   // Start conversions from the TMR2 interrupt
+        TMR2IE = 1;
+    }
+    ADIE = 1;                   // Enable the ADC conversion-complete interrupt
+    PEIE = 1;                   // Enable peripheral interrupts
+    GIE = 1;                    // Enable global interrupts
+    
+    return ((unsigned int)((_XTAL_FREQ / 4 + counts / 2) / counts));
+}
+
+// Return the number of samples waiting in the ADC ring buffer.
+unsigned char ADC_samples_available(void)
+{
+    return ((unsigned char)(adcHead - adcTail));
+}
+
+// Remove and return the oldest sample in the ADC ring buffer.
+unsigned int ADC_get_sample(void)
+{
+    unsigned int sample;
+    
+    if(adcHead == adcTail)      // Return 0 if no samples are available
+    {
+        return (0);
+    }
+    sample = adcBuffer[adcTail & (ADC_BUFFER_SIZE - 1)];
+    adcTail ++;                 // Free the location only after reading it
+    return (sample);
+}
+
+// Scan step, called by ADC_isr() after each scan conversion. The input mux is
+// switched and the next acquisition is timed before the finished result is
+// processed, so settling of the next channel overlaps the processing.
+static void ADC_scan_next(void)
+{
+    unsigned int result = ((unsigned int)ADRESH << 2) | (ADRESL >> 6);
+    unsigned char entry = scanIndex;
+    
+    scanConversions --;
+    if(scanConversions != 0)
+    {
+        PR2 = ADC_REPEAT_PR2;   // Convert the same channel again after 2 TAD
+        TMR2 = 0;
+        TMR2ON = 1;
+        scanSum += result;
+        return;
+    }
+    
+    // Last conversion for this entry: switch to the next channel first
+    scanIndex ++;
+    if(scanIndex == scanEntries)
+    {
+        scanIndex = 0;
+    }
+    if(scanIndex != 0 || scanRepeat)
+    {
+        ADCON0 = scanChannel[scanIndex];    // Channel and ADON in one write
+        PR2 = scanPeriod[scanIndex];
+        TMR2 = 0;
+        TMR2ON = 1;             // Time the next channel's acquisition
+        scanConversions = (unsigned char)(1 << scanShift[scanIndex]);
+    }
+    else
+    {
+        adcScanning = false;    // Single scan finished
+    }
+    
+    // Then average the finished entry's results while the next one settles
+    scanResults[entry] = (scanSum + result) >> scanShift[entry];
+    scanSum = 0;
+    if(scanIndex == 0)
+    {
+        scanDone = true;
+    }
+}
+
+// ADC conversion-complete interrupt handler. Store the result in the ring
+// buffer, or count an overrun if the buffer is full, and restart the ADC.
+void ADC_isr(void)
+{
+    if(ADIF && ADIE)
+    {
+        ADIF = 0;
+        if(adcScanning)
+        {
+            ADC_scan_next();    // Store the scan result and start the next one
+        }
+        else if((unsigned char)(adcHead - adcTail) != ADC_BUFFER_SIZE)
+        {
+            adcBuffer[adcHead & (ADC_BUFFER_SIZE - 1)] = ((unsigned int)ADRESH << 8) | ADRESL;
+            adcHead ++;         // Publish the sample only after it is stored
+        }
+        else
+        {
+            ADC_overruns ++;    // Buffer is full, discard the newest sample
+        }
+        if(adcContinuous)
+        {
+            GO = 1;             // Start the next conversion
+        }
+    }
+    if(TMR2IF && TMR2IE && (adcScanning || adcTimerStart))
+    {
+        TMR2IF = 0;
+        if(adcScanning)
+        {
+            TMR2ON = 0;         // Acquisition time is over, stop the timer
+            GO = 1;             // and convert the scan channel
+        }
+        else
+        {
+            GO = 1;             // Start the conversion for this sample period
+        }
+    }
+}
@@ -94,9 +94,117 @@
 #define AN11        0b00101100      // A-D converter channel 11 input (SW3)
 #define ANTIM       0b01110100      // On-die temperature indicator module input
 
+// True if ch is one of the UBMP4 ADC channel constants above. Use
+// ADC_CHECK_CHANNEL() outside of a function to stop the build with an error if
+// a channel constant is not valid, e.g. ADC_CHECK_CHANNEL(LIGHT_CHANNEL);
+#define ADC_VALID_CHANNEL(ch) ((ch) == AN4 || (ch) == AN5 || (ch) == AN6 || \
+        (ch) == AN7 || (ch) == AN8 || (ch) == AN9 || (ch) == AN10 || \
+        (ch) == AN11 || (ch) == ANTIM)
+#define ADC_CHECK_CHANNEL(ch) ADC_CHECK_CHANNEL_AT(ch, __LINE__)
+#define ADC_CHECK_CHANNEL_AT(ch, line) ADC_CHECK_CHANNEL_NAME(ch, line)
+#define ADC_CHECK_CHANNEL_NAME(ch, line) \
+        typedef char adcInvalidChannel##line[(ADC_VALID_CHANNEL(ch)) ? 1 : -1]
+
+// ADC channel descriptor. The descriptor table in UBMP4.c holds one entry for
+// each ADC channel, indexed by the channel constant's CHS bits (channel >> 2).
+typedef struct
+{
+    unsigned char adcon0;       // ADCON0 value: channel select and ADON set
+    unsigned char port;         // Port with the analog pin (ADC_PIN_PORTB/C)
+    unsigned char pin;          // Pin bit mask in the port's ANSEL/TRIS
+    unsigned char acquisition;  // Minimum acquisition time in microseconds
+} ADC_channel_t;
+
+#define ADC_PIN_NONE    0           // Internal channel, no pin to configure
+#define ADC_PIN_PORTB   1           // Analog pin on PORTB
+#define ADC_PIN_PORTC   2           // Analog pin on PORTC
+
+// Acquisition times in microseconds. Pins need 5us to charge the ADC's hold
+// capacitor. The temperature indicator (ANTIM) has a high output impedance,
+// and the data sheet (Temperature Indicator Module) asks for at least 200us
+// of acquisition after it is selected. The indicator is powered by the FVR
+// module (TSEN), so it must also have been enabled at least that long before.
+#define ADC_PIN_ACQUISITION     5   // Analog pin minimum acquisition time
+#define ADC_TEMP_ACQUISITION    200 // Temperature indicator minimum acquisition
+
+// Result of the 10-bit channel reads for a channel that is not one of the
+// UBMP4 channel constants (outside of the 0-1023 range of real results)
+#define ADC_INVALID     0xFFFF
+
+// Highest resolution produced by ADC_read_oversampled() (64 conversions)
+#define ADC_OVERSAMPLE_MAX_BITS 13
+
+// ADC FRC (dedicated RC oscillator) clock setting for ADCON1, used for
+// conversions during Sleep
+#define ADC_FRC_CLOCK   0b01110000
+
+// Range of conversion counts (as powers of 2) used by ADC_variance()
+#define ADC_VARIANCE_MIN_SAMPLES 2  // 4 conversions
+#define ADC_VARIANCE_MAX_SAMPLES 6  // 64 conversions
+
+// ADC ring buffer size (must be a power of 2, no larger than 128 samples)
+#define ADC_BUFFER_SIZE 16          // Number of samples held by the buffer
+
+// ADC timed sampling rate limits (samples per second)
+#define ADC_TRIGGER_MIN_RATE 46     // Slowest rate TMR2 can time (46 Hz)
+#define ADC_MAX_RATE    20000       // Fastest rate ADC_isr() can keep up with
+
+// TMR2 settings for a constant sample rate, worked out by the compiler using
+// the same search as ADC_start_timed_sampling(): the smallest prescaler (1:1
+// to 1:64), then postscaler (1:1 to 1:16), that fits the sample period into
+// the 8-bit PR2 register. Used by ADC_START_TIMED_SAMPLING().
+#define ADC_RATE_COUNTS(rate)   ((_XTAL_FREQ / 4 + (rate) / 2) / (rate))
+#define ADC_RATE_PRESCALE(rate) (ADC_RATE_COUNTS(rate) <= 256UL ? 0 : \
+        ADC_RATE_COUNTS(rate) <= 1024UL ? 1 : ADC_RATE_COUNTS(rate) <= 4096UL ? 2 : 3)
+#define ADC_RATE_SCALE(rate)    (256UL << (ADC_RATE_PRESCALE(rate) * 2))
+#define ADC_RATE_POSTSCALE(rate) \
+        ((ADC_RATE_COUNTS(rate) + ADC_RATE_SCALE(rate) - 1) / ADC_RATE_SCALE(rate))
+#define ADC_RATE_DIVISOR(rate)  \
+        ((unsigned long)ADC_RATE_POSTSCALE(rate) << (ADC_RATE_PRESCALE(rate) * 2))
+#define ADC_RATE_PERIOD(rate)   \
+        ((ADC_RATE_COUNTS(rate) + ADC_RATE_DIVISOR(rate) / 2) / ADC_RATE_DIVISOR(rate))
+#define ADC_RATE_PR2(rate)      ((unsigned char)(ADC_RATE_PERIOD(rate) - 1))
+#define ADC_RATE_T2CON(rate)    \
+        ((unsigned char)(((ADC_RATE_POSTSCALE(rate) - 1) << 3) | ADC_RATE_PRESCALE(rate)))
+#define ADC_RATE_ACTUAL(rate)   ((unsigned int)((_XTAL_FREQ / 4 + \
+        ADC_RATE_PERIOD(rate) * ADC_RATE_DIVISOR(rate) / 2) / \
+        (ADC_RATE_PERIOD(rate) * ADC_RATE_DIVISOR(rate))))
+#define ADC_VALID_RATE(rate)    ((rate) >= ADC_TRIGGER_MIN_RATE && (rate) <= ADC_MAX_RATE)
+
+// Start timed sampling at a constant rate, e.g. ADC_START_TIMED_SAMPLING(ANQ1,
+// 1000). The TMR2 settings and the returned actual rate are constants, so no
+// division is done at run time, and a rate outside of ADC_TRIGGER_MIN_RATE to
+// ADC_MAX_RATE stops the build with an error. Use ADC_start_timed_sampling()
+// for rates that are only known at run time.
+#define ADC_START_TIMED_SAMPLING(channel, rate) \
+        ((void)sizeof(char[ADC_VALID_RATE(rate) ? 1 : -1]), \
+        ADC_start_tmr2_timer((channel), ADC_RATE_T2CON(rate), ADC_RATE_PR2(rate)) ? \
+        ADC_RATE_ACTUAL(rate) : 0)
+
+// ADC scan list entry. Each entry selects a channel, the acquisition time to
+// allow after switching to it (in microseconds, 0-255, and never less than
+// the channel's ADC_acquisition_time()), and the number of conversions to
+// average as a power of 2 (0 = 1 conversion, up to 6 = 64).
+typedef struct
+{
+    unsigned char channel;      // ADC channel constant (e.g. ANQ1)
+    unsigned char acquisition;  // Acquisition (settling) time in microseconds
+    unsigned char oversample;   // log2 of the number of conversions averaged
+} ADC_scan_entry_t;
+
+#define ADC_SCAN_MAX    8           // Maximum number of entries in a scan list
+
+// ADC ring buffer overrun counter (counts samples discarded while full)
+extern volatile unsigned char ADC_overruns;
+
 // Clock frequency definition for delay macros and simulation
 #define _XTAL_FREQ  48000000        // Set clock frequency for time delays
 
+// Uncomment to build for the MPLAB X simulator (or define SIMULATION in the
+// project's compiler macros). The simulator never reports PLL lock, so
+// OSC_config() skips waiting for it.
+// #define SIMULATION
+
 // Prototypes for UBMP420.c functions:
 
 /**
@@ -121,14 +229,37 @@ void UBMP4_config(void);
 void ADC_config(void);
 
 /**
- * Function: void ADC_select_channel(unsigned char channel)
+ * Function: bool ADC_enable_input(unsigned char channel)
+ * 
+ * Make the pin used by an ADC channel an analog input by setting its ANSEL
+ * and TRIS bits. Returns false if the channel is not one of the UBMP4 channel
+ * constants defined above.
+ * 
+ * Example usage: ADC_enable_input(ANH1);
+ */
+bool ADC_enable_input(unsigned char);
+
+/**
+ * Function: bool ADC_select_channel(unsigned char channel)
  * 
- * Enable ADC and switch ADC input mux to the channel specified by one of the
- * channel constants defined above.
+ * Enable ADC, make the channel's pin an analog input, and switch ADC input
+ * mux to the channel specified by one of the channel constants defined above,
+ * using a single ADCON0 write. Returns false for channels that are not in the
+ * channel table, leaving the ADC unchanged.
  * 
  * Example usage: ADC_select_channel(ANTIM);
  */
-void ADC_select_channel(unsigned char);
+bool ADC_select_channel(unsigned char);
+
+/**
+ * Function: unsigned char ADC_acquisition_time(unsigned char channel)
+ * 
+ * Return the minimum acquisition (settling) time of a channel in
+ * microseconds, from the channel table, or 0 if the channel is not valid.
+ * 
+ * Example usage: ADC_acquisition_time(ANTIM);  // 200us
+ */
+unsigned char ADC_acquisition_time(unsigned char);
 
 /**
  * Function: unsigned char ADC_read(void)
@@ -143,11 +274,212 @@ unsigned char ADC_read(void);
  * Function: unsigned char ADC_read_channel(unsigned char channel)
  * 
  * Enable ADC, switch to the channel specified by one of the channel constants
- * defined above, and return an 8-bit conversion result.
+ * defined above, and return an 8-bit conversion result. Returns 0 without
+ * starting a conversion if the channel is not valid.
  * 
  * Example usage: light_level = ADC_read_channel(ANQ1);
  */
 unsigned char ADC_read_channel(unsigned char);
 
+/**
+ * Function: unsigned int ADC_read_10bit(void)
+ * 
+ * Convert currently selected ADC channel and return the full 10-bit conversion
+ * result, right-justified (0-1023).
+ * 
+ * Example usage: light_level = ADC_read_10bit();
+ */
+unsigned int ADC_read_10bit(void);
+
+/**
+ * Function: unsigned int ADC_read_channel_10bit(unsigned char channel)
+ * 
+ * Enable ADC, switch to the channel specified by one of the channel constants
+ * defined above, and return a right-justified 10-bit conversion result, or
+ * ADC_INVALID without starting a conversion if the channel is not valid.
+ * 
+ * Example usage: light_level = ADC_read_channel_10bit(ANQ1);
+ */
+unsigned int ADC_read_channel_10bit(unsigned char);
+
+/**
+ * Function: unsigned int ADC_read_oversampled(unsigned char bits)
+ * 
+ * Convert the currently selected ADC channel 4^(bits - 10) times and decimate
+ * the sum to a right-justified result with the specified resolution, from 10
+ * to ADC_OVERSAMPLE_MAX_BITS bits. Each extra bit of resolution takes 4 times
+ * as many conversions (11 bits = 4, 12 bits = 16, 13 bits = 64 conversions).
+ * The extra resolution is only real if the input has at least 1 LSB of noise,
+ * which is true of the on-die temperature indicator (ANTIM). Uses shifts only.
+ * 
+ * Example usage: temperature = ADC_read_oversampled(12);
+ */
+unsigned int ADC_read_oversampled(unsigned char);
+
+/**
+ * Function: unsigned int ADC_read_channel_sleep(unsigned char channel)
+ * 
+ * Enable ADC, switch to the specified channel, and return a right-justified
+ * 10-bit result converted using the ADC's FRC clock while the core sleeps.
+ * Stopping the CPU and PLL during the conversion lowers the noise in the
+ * result and the power used. Sleep stops the instruction clock, so if a
+ * timer-driven module or USB is running (TMR0IE, TMR1ON, TMR2ON, TXIE or
+ * USBEN set - the scheduler, LED display, H1/H2 serial, tone, timed sampling,
+ * PWM, EUSART output or USB-CDC) the result is converted awake instead, like
+ * ADC_read_channel_10bit(). Stop them first to get a Sleep conversion.
+ * Returns ADC_INVALID if the channel is not valid.
+ * 
+ * Example usage: light_level = ADC_read_channel_sleep(ANQ1);
+ */
+unsigned int ADC_read_channel_sleep(unsigned char);
+
+/**
+ * Function: unsigned int ADC_variance(unsigned char channel,
+ *                                     unsigned char samples, bool sleep)
+ * 
+ * Convert the specified channel 2^samples times (2^2 to 2^6) and return the
+ * variance of the 10-bit results in 1/16 LSB^2 steps (e.g. 16 = 1 LSB^2).
+ * Conversions are made using ADC_read_channel_sleep() if sleep is true, or
+ * ADC_read_channel_10bit() if false, so that the noise of the two methods
+ * can be compared on a steady input.
+ * 
+ * Example usage: sleepNoise = ADC_variance(ANTIM, 6, true);
+ */
+unsigned int ADC_variance(unsigned char, unsigned char, bool);
+
+/**
+ * Function: void ADC_start_sampling(unsigned char channel, bool continuous)
+ * 
+ * Enable ADC, switch to the specified channel, enable the ADC interrupt, and
+ * start an interrupt-driven conversion. Each result is stored in the ADC ring
+ * buffer by ADC_isr(). If continuous is true, a new conversion is started as
+ * soon as the previous result has been stored. Does nothing if the channel is
+ * not valid.
+ * 
+ * Example usage: ADC_start_sampling(ANQ1, true);
+ */
+void ADC_start_sampling(unsigned char, bool);
+
+/**
+ * Function: unsigned int ADC_start_timed_sampling(unsigned char channel,
+ *                                                 unsigned int rate)
+ * 
+ * Enable ADC, switch to the specified channel, and start interrupt-driven
+ * sampling at a fixed rate (in samples per second) timed by TMR2. Rates from
+ * ADC_TRIGGER_MIN_RATE up to ADC_MAX_RATE are accepted. Rates from 733 Hz
+ * up use the ADCON2 TMR2 match auto-conversion trigger so that no software is
+ * involved in starting a conversion. Slower rates use the TMR2 postscaler and
+ * start each conversion from the TMR2 interrupt, which delays every sample by
+ * the same interrupt latency. Results are stored in the ADC ring buffer.
+ * Returns the actual sample rate produced by the timer, or 0 if the requested
+ * rate is outside the supported range or the channel is not valid. (Uses
+ * TMR2.) The timer settings are searched for at run time using long
+ * division, so use ADC_START_TIMED_SAMPLING() instead for constant rates.
+ * 
+ * Example usage: actual_rate = ADC_start_timed_sampling(ANQ1, rate);
+ */
+unsigned int ADC_start_timed_sampling(unsigned char, unsigned int);
+
+/**
+ * Function: bool ADC_start_tmr2_timer(unsigned char channel,
+ *                                     unsigned char t2con, unsigned char pr2)
+ * 
+ * Enable ADC, switch to the specified channel, and start interrupt-driven
+ * sampling timed by TMR2 using the T2CON and PR2 values supplied, as worked
+ * out by ADC_RATE_T2CON() and ADC_RATE_PR2() or by ADC_start_timed_sampling().
+ * Returns false without changing TMR2 if the channel is not valid. Normally
+ * called through ADC_START_TIMED_SAMPLING().
+ * 
+ * Example usage: ADC_start_tmr2_timer(ANQ1, ADC_RATE_T2CON(1000), ADC_RATE_PR2(1000));
+ */
+bool ADC_start_tmr2_timer(unsigned char, unsigned char, unsigned char);
+
+/**
+ * Function: unsigned int ADC_start_tmr2_sampling(unsigned char channel,
+ *                                                unsigned char periods)
+ * 
+ * Enable ADC, switch to the specified channel, and start interrupt-driven
+ * sampling once every 1 to 16 periods of TMR2, using the TMR2 period and
+ * prescaler already set (e.g. by PWM_start()) and only changing the
+ * postscaler. Results are stored in the ADC ring buffer. Returns the actual
+ * sample rate, or 0 if TMR2 isn't running, the channel is not valid, or the
+ * rate would be faster than ADC_MAX_RATE.
+ * 
+ * Example usage: rate = ADC_start_tmr2_sampling(ANQ1, 4);
+ */
+unsigned int ADC_start_tmr2_sampling(unsigned char, unsigned char);
+
+/**
+ * Function: bool ADC_start_scan(const ADC_scan_entry_t *list,
+ *                               unsigned char entries, bool continuous)
+ * 
+ * Enable ADC and start an interrupt-driven scan through a list of up to
+ * ADC_SCAN_MAX channels, using TMR2 to time each channel's acquisition time.
+ * The input mux is switched to the next channel as soon as the last
+ * conversion of the current channel finishes, so the next channel settles
+ * while the previous result is being stored. If continuous is true, the scan
+ * repeats until ADC_stop_sampling() is called. Returns false if the list is
+ * empty, too long, has a channel that is not a UBMP4 channel constant, or
+ * has an oversample value larger than 6. (Uses TMR2.)
+ * 
+ * Example usage: ADC_start_scan(scanList, 2, true);
+ */
+bool ADC_start_scan(const ADC_scan_entry_t *, unsigned char, bool);
+
+/**
+ * Function: bool ADC_scan_complete(void)
+ * 
+ * Return true once each time a full scan has finished since the last call.
+ * 
+ * Example usage: if(ADC_scan_complete())
+ */
+bool ADC_scan_complete(void);
+
+/**
+ * Function: unsigned int ADC_scan_result(unsigned char entry)
+ * 
+ * Return the latest 10-bit averaged result for the specified scan list entry.
+ * 
+ * Example usage: light_level = ADC_scan_result(0);
+ */
+unsigned int ADC_scan_result(unsigned char);
+
+/**
+ * Function: void ADC_stop_sampling(void)
+ * 
+ * Stop interrupt-driven sampling after the conversion in progress finishes.
+ * Samples already in the ring buffer remain available to ADC_get_sample().
+ */
+void ADC_stop_sampling(void);
+
+/**
+ * Function: unsigned char ADC_samples_available(void)
+ * 
+ * Return the number of samples waiting in the ADC ring buffer. Never blocks.
+ * 
+ * Example usage: if(ADC_samples_available() != 0)
+ */
+unsigned char ADC_samples_available(void);
+
+/**
+ * Function: unsigned int ADC_get_sample(void)
+ * 
+ * Remove and return the oldest sample from the ADC ring buffer as a 16-bit
+ * value containing ADRESH in the upper byte and ADRESL in the lower byte.
+ * Check ADC_samples_available() first - returns 0 if the buffer is empty.
+ * 
+ * Example usage: rawADC = (unsigned char)(ADC_get_sample() >> 8);
+ */
+unsigned int ADC_get_sample(void);
+
+/**
+ * Function: void ADC_isr(void)
+ * 
+ * ADC conversion-complete and sample timer interrupt handler. Call from the
+ * program's interrupt service routine. Does nothing unless the ADC or TMR2
+ * interrupt is enabled and its interrupt flag is set.
+ */
+void ADC_isr(void);
+
 // TODO - Add additional function prototypes for any new functions added to
 // the UBMP420.c file here.
@@ -0,0 +1,531 @@
+/*==============================================================================
+ Library:   USB-CDC
+ Date:      October 17, 2026
+ 
+ USB CDC-ACM (virtual serial port) device. See USB-CDC.h for its use. Nothing
+ in this file is compiled unless USB_CDC is defined.
+ 
+ The USB module's serial interface engine (SIE) reads and writes endpoint
+ buffers by itself, using a table of 4 byte buffer descriptors (BDs) in the
+ dual-port RAM. Setting a BD's UOWN bit hands its buffer to the SIE, and the
+ SIE clears UOWN and sets TRNIF when a packet has been sent or received.
+ Ping-pong buffering is enabled for every endpoint except endpoint 0, so
+ endpoints 1 and 2 each have an even and an odd BD in each direction, and
+ the SIE alternates between them.
+ 
+ Endpoint 0 handles the control transfers used by the computer to enumerate
+ and configure the device, and is run entirely from USB_isr(). The bulk data
+ IN buffers are only filled by USB_CDC_write(), which checks UOWN itself, so
+ sending data doesn't need the interrupt.
+ =============================================================================*/
+
+#include    "xc.h"              // Microchip XC8 compiler include file
+#include    "stdint.h"          // Include integer definitions
+#include    "stdbool.h"         // Include Boolean (true/false) definitions
+
+#include    "UBMP4.h"           // Include UBMP4 constants and functions
+#include    "USB-CDC.h"         // Include USB CDC functions
+
+#ifdef USB_CDC
+
+// Buffer descriptor STAT bits (CPU mode)
+#define BD_UOWN     0b10000000  // SIE owns the buffer
+#define BD_DTS      0b01000000  // DATA1 packet (DATA0 if clear)
+#define BD_DTSEN    0b00001000  // Only accept the expected data toggle
+#define BD_BSTALL   0b00000100  // Stall the endpoint
+#define BD_PID(stat) (((stat) >> 2) & 0x0F) // Token PID (SIE mode)
+
+#define PID_SETUP   0x0D        // SETUP token PID
+
+// Buffer descriptor table index of each endpoint buffer (UCFG PPB = 11)
+#define BD_EP0_OUT  0
+#define BD_EP0_IN   1
+#define BD_EP1_IN   4           // Even, odd is 5
+#define BD_EP2_OUT  6           // Even, odd is 7
+#define BD_EP2_IN   8           // Even, odd is 9
+#define BD_COUNT    10
+
+// Buffer descriptor
+typedef struct
+{
+    unsigned char STAT;         // Status and control bits
+    unsigned char CNT;          // Byte count
+    unsigned char ADRL;         // Buffer linear address, low byte
+    unsigned char ADRH;         // Buffer linear address, high byte
+} USB_bd_t;
+
+// Buffer descriptor table and endpoint buffers in the dual-port RAM
+USB_bd_t usbBD[BD_COUNT] __at(0x2000);
+unsigned char usbEP0Out[USB_EP0_SIZE] __at(0x2028);
+unsigned char usbEP0In[USB_EP0_SIZE] __at(0x2038);
+unsigned char usbEP1In[8] __at(0x2048);
+unsigned char usbEP2Out[2][USB_CDC_OUT_SIZE] __at(0x2050);
+unsigned char usbEP2In[2][USB_CDC_IN_SIZE] __at(0x2070);
+
+// Standard and CDC class request codes
+#define REQ_GET_STATUS          0
+#define REQ_CLEAR_FEATURE       1
+#define REQ_SET_FEATURE         3
+#define REQ_SET_ADDRESS         5
+#define REQ_GET_DESCRIPTOR      6
+#define REQ_GET_CONFIGURATION   8
+#define REQ_SET_CONFIGURATION   9
+#define REQ_GET_INTERFACE       10
+#define REQ_SET_INTERFACE       11
+#define REQ_SET_LINE_CODING     0x20
+#define REQ_GET_LINE_CODING     0x21
+#define REQ_SET_CONTROL_LINE_STATE 0x22
+
+// Control transfer stages
+#define CTRL_IDLE       0       // Waiting for a SETUP packet
+#define CTRL_IN_DATA    1       // Sending data to the computer
+#define CTRL_OUT_DATA   2       // Receiving data from the computer
+#define CTRL_STATUS_IN  3       // Sending the zero length status packet
+
+// Device descriptor
+const unsigned char usbDeviceDescriptor[18] = {
+    18, 1,                      // Length, DEVICE descriptor
+    0x00, 0x02,                 // USB 2.0
+    0x02, 0x00, 0x00,           // CDC class device
+    USB_EP0_SIZE,               // Endpoint 0 packet size
+    (unsigned char)USB_VID, (unsigned char)(USB_VID >> 8),
+    (unsigned char)USB_PID, (unsigned char)(USB_PID >> 8),
+    0x00, 0x01,                 // Device release 1.00
+    1, 2, 0,                    // Manufacturer, product, no serial number
+    1                           // One configuration
+};
+
+// Configuration descriptor, followed by its interface, CDC functional and
+// endpoint descriptors
+const unsigned char usbConfigDescriptor[67] = {
+    9, 2, 67, 0,                // Length, CONFIGURATION, total length
+    2, 1, 0,                    // Two interfaces, configuration 1, no string
+    0x80, 50,                   // Bus powered, 100mA
+
+    9, 4, 0, 0, 1,              // Interface 0 (communication), 1 endpoint
+    0x02, 0x02, 0x01, 0,        // CDC, abstract control model, AT commands
+    5, 0x24, 0x00, 0x10, 0x01,  // CDC header, CDC 1.10
+    5, 0x24, 0x01, 0x00, 1,     // Call management, data interface 1
+    4, 0x24, 0x02, 0x02,        // ACM, supports line coding and line state
+    5, 0x24, 0x06, 0, 1,        // Union of interfaces 0 and 1
+    7, 5, 0x81, 0x03, 8, 0, 255,    // EP1 IN interrupt, 8 bytes, 255ms
+
+    9, 4, 1, 0, 2,              // Interface 1 (data), 2 endpoints
+    0x0A, 0x00, 0x00, 0,        // CDC data
+    7, 5, 0x02, 0x02, USB_CDC_OUT_SIZE, 0, 0,   // EP2 OUT bulk
+    7, 5, 0x82, 0x02, USB_CDC_IN_SIZE, 0, 0     // EP2 IN bulk
+};
+
+// String descriptors (UTF-16)
+const unsigned char usbString0[4] = {
+    4, 3, 0x09, 0x04            // English (US)
+};
+const unsigned char usbString1[24] = {
+    24, 3,
+    'm', 0, 'i', 0, 'r', 0, 'o', 0, 'b', 0, 'o', 0, '.', 0, 't', 0, 'e', 0,
+    'c', 0, 'h', 0
+};
+const unsigned char usbString2[40] = {
+    40, 3,
+    'U', 0, 'B', 0, 'M', 0, 'P', 0, '4', 0, ' ', 0, 'S', 0, 'a', 0, 'm', 0,
+    'p', 0, 'l', 0, 'e', 0, ' ', 0, 'S', 0, 't', 0, 'r', 0, 'e', 0, 'a', 0,
+    'm', 0
+};
+
+// Device and control transfer state
+unsigned char usbSetup[8];              // Latest SETUP packet
+unsigned char usbConfiguration;         // Configuration set by the computer
+unsigned char usbPendingAddress;        // Address to set after SET_ADDRESS
+unsigned char usbStage;                 // Control transfer stage
+const unsigned char *usbCtrlData;       // Next control IN data (ROM or RAM)
+unsigned char usbCtrlLeft;              // Control IN bytes left to send
+bool usbCtrlZLP;                        // End the IN data with a zero length packet
+bool usbCtrlDTS;                        // Data toggle of the next IN packet
+const unsigned char usbZeros[2] = {0, 0};   // GET_STATUS and GET_INTERFACE data
+
+// CDC state
+unsigned char cdcLineCoding[7] = {0x80, 0x25, 0x00, 0x00, 0, 0, 8}; // 9600,8,N,1
+bool cdcDTR;                            // Terminal has the port open
+unsigned char cdcInNext;                // IN buffer being filled (0 even, 1 odd)
+unsigned char cdcInCount;               // Bytes in the IN buffer being filled
+
+// Point a buffer descriptor at a buffer
+static void usb_bd_address(unsigned char bd, unsigned char *buffer)
+{
+    usbBD[bd].ADRL = (unsigned char)((unsigned int)buffer);
+    usbBD[bd].ADRH = (unsigned char)((unsigned int)buffer >> 8);
+}
+
+// Give the endpoint 0 OUT buffer to the SIE to receive the next SETUP packet,
+// OUT data, or the status packet that ends an IN transfer
+static void usb_ep0_receive(void)
+{
+    usbBD[BD_EP0_OUT].CNT = USB_EP0_SIZE;
+    usbBD[BD_EP0_OUT].STAT = BD_UOWN;
+}
+
+// Send the next packet of control IN data (or a zero length packet)
+static void usb_ep0_send(void)
+{
+    unsigned char count = (usbCtrlLeft < USB_EP0_SIZE) ? usbCtrlLeft : USB_EP0_SIZE;
+    
+    for(unsigned char i = 0; i != count; i++)
+    {
+        usbEP0In[i] = *usbCtrlData;
+        usbCtrlData ++;
+    }
+    usbCtrlLeft -= count;
+    usbBD[BD_EP0_IN].CNT = count;
+    usbBD[BD_EP0_IN].STAT = BD_UOWN | BD_DTSEN | ((usbCtrlDTS) ? BD_DTS : 0);
+    usbCtrlDTS = !usbCtrlDTS;
+}
+
+// Set up endpoints 1 and 2 for the configuration
+static void usb_configure_endpoints(void)
+{
+    PPBRST = 1;                 // Reset the ping-pong buffer pointers to even
+    UEP1 = 0b00011010;          // EP1: handshake, no control, IN only
+    UEP2 = 0b00011110;          // EP2: handshake, no control, IN and OUT
+    for(unsigned char odd = 0; odd != 2; odd++)
+    {
+        usbBD[BD_EP1_IN + odd].STAT = 0;    // Notifications are never sent
+        usb_bd_address(BD_EP1_IN + odd, usbEP1In);
+        usb_bd_address(BD_EP2_OUT + odd, usbEP2Out[odd]);
+        usbBD[BD_EP2_OUT + odd].CNT = USB_CDC_OUT_SIZE;
+        usbBD[BD_EP2_OUT + odd].STAT = BD_UOWN;
+        usb_bd_address(BD_EP2_IN + odd, usbEP2In[odd]);
+        usbBD[BD_EP2_IN + odd].STAT = 0;
+    }
+    cdcInNext = 0;
+    cdcInCount = 0;
+    PPBRST = 0;
+}
+
+// Handle a SETUP packet. Requests that aren't supported stall endpoint 0.
+static void usb_setup(void)
+{
+    bool handled = true;
+    unsigned char length = 0;   // Control IN data length
+    
+    usbCtrlData = usbZeros;
+    if((usbSetup[0] & 0b01100000) == 0)     // Standard requests
+    {
+        switch(usbSetup[1])
+        {
+            case REQ_GET_STATUS:
+                length = 2;
+                break;
+            case REQ_CLEAR_FEATURE:
+            case REQ_SET_FEATURE:
+            case REQ_SET_INTERFACE:
+                break;
+            case REQ_SET_ADDRESS:
+                usbPendingAddress = usbSetup[2];    // Set after the status stage
+                break;
+            case REQ_GET_DESCRIPTOR:
+                if(usbSetup[3] == 1)
+                {
+                    usbCtrlData = usbDeviceDescriptor;
+                    length = sizeof(usbDeviceDescriptor);
+                }
+                else if(usbSetup[3] == 2)
+                {
+                    usbCtrlData = usbConfigDescriptor;
+                    length = sizeof(usbConfigDescriptor);
+                }
+                else if(usbSetup[3] == 3 && usbSetup[2] == 0)
+                {
+                    usbCtrlData = usbString0;
+                    length = sizeof(usbString0);
+                }
+                else if(usbSetup[3] == 3 && usbSetup[2] == 1)
+                {
+                    usbCtrlData = usbString1;
+                    length = sizeof(usbString1);
+                }
+                else if(usbSetup[3] == 3 && usbSetup[2] == 2)
+                {
+                    usbCtrlData = usbString2;
+                    length = sizeof(usbString2);
+                }
+                else
+                {
+                    handled = false;
+                }
+                break;
+            case REQ_GET_CONFIGURATION:
+                usbCtrlData = &usbConfiguration;
+                length = 1;
+                break;
+            case REQ_SET_CONFIGURATION:
+                usbConfiguration = usbSetup[2];
+                if(usbConfiguration != 0)
+                {
+                    usb_configure_endpoints();
+                }
+                break;
+            case REQ_GET_INTERFACE:
+                length = 1;
+                break;
+            default:
+                handled = false;
+        }
+    }
+    else if((usbSetup[0] & 0b01100000) == 0b00100000)   // Class requests
+    {
+        switch(usbSetup[1])
+        {
+            case REQ_SET_LINE_CODING:
+                break;          // Line coding is received in the data stage
+            case REQ_GET_LINE_CODING:
+                usbCtrlData = cdcLineCoding;
+                length = sizeof(cdcLineCoding);
+                break;
+            case REQ_SET_CONTROL_LINE_STATE:
+                cdcDTR = (usbSetup[2] & 0b00000001);
+                break;
+            default:
+                handled = false;
+        }
+    }
+    else
+    {
+        handled = false;
+    }
+    
+    usbCtrlDTS = true;          // Data and status stages start with DATA1
+    if(!handled)
+    {
+        usbStage = CTRL_IDLE;
+        usbBD[BD_EP0_IN].STAT = BD_UOWN | BD_BSTALL;    // Stall until the
+        usbBD[BD_EP0_OUT].CNT = USB_EP0_SIZE;           // next SETUP packet
+        usbBD[BD_EP0_OUT].STAT = BD_UOWN | BD_BSTALL;
+        return;
+    }
+    if(usbSetup[0] & 0b10000000)        // Device to host (IN) data stage
+    {
+        // Send no more than the computer asked for, and end with a zero
+        // length packet if a shorter reply is a multiple of the packet size
+        if(usbSetup[7] == 0 && length > usbSetup[6])
+        {
+            length = usbSetup[6];
+        }
+        usbCtrlZLP = (usbSetup[7] != 0 || length < usbSetup[6]) && (length % USB_EP0_SIZE) == 0;
+        usbCtrlLeft = length;
+        usbStage = CTRL_IN_DATA;
+        usb_ep0_send();
+        usb_ep0_receive();      // For the status stage (or a new SETUP)
+    }
+    else if(usbSetup[6] != 0 || usbSetup[7] != 0)   // Host to device data
+    {
+        usbStage = CTRL_OUT_DATA;
+        usb_ep0_receive();
+    }
+    else                        // No data stage, send the status packet
+    {
+        usbCtrlLeft = 0;
+        usbStage = CTRL_STATUS_IN;
+        usb_ep0_send();
+        usb_ep0_receive();
+    }
+}
+
+// Handle a completed endpoint 0 transaction
+static void usb_ep0_transaction(bool in)
+{
+    if(in)
+    {
+        if(usbStage == CTRL_IN_DATA)
+        {
+            if(usbCtrlLeft != 0)
+            {
+                usb_ep0_send();
+            }
+            else if(usbCtrlZLP)
+            {
+                usbCtrlZLP = false;
+                usb_ep0_send(); // Zero length packet ends the data stage
+            }
+        }
+        else if(usbStage == CTRL_STATUS_IN)
+        {
+            if(usbPendingAddress != 0)
+            {
+                UADDR = usbPendingAddress;
+                usbPendingAddress = 0;
+            }
+            usbStage = CTRL_IDLE;
+        }
+        return;
+    }
+    
+    if(BD_PID(usbBD[BD_EP0_OUT].STAT) == PID_SETUP)
+    {
+        for(unsigned char i = 0; i != 8; i++)
+        {
+            usbSetup[i] = usbEP0Out[i];
+        }
+        usbBD[BD_EP0_IN].STAT = 0;  // Cancel anything left from the last transfer
+        usb_setup();
+        PKTDIS = 0;             // The SIE stops after SETUP until this is cleared
+        return;
+    }
+    if(usbStage == CTRL_OUT_DATA)
+    {
+        // SET_LINE_CODING data, then send the status packet
+        if(usbSetup[1] == REQ_SET_LINE_CODING && usbBD[BD_EP0_OUT].CNT >= sizeof(cdcLineCoding))
+        {
+            for(unsigned char i = 0; i != sizeof(cdcLineCoding); i++)
+            {
+                cdcLineCoding[i] = usbEP0Out[i];
+            }
+        }
+        usbCtrlLeft = 0;
+        usbStage = CTRL_STATUS_IN;
+        usb_ep0_send();
+    }
+    else
+    {
+        usbStage = CTRL_IDLE;   // Status packet after IN data received
+    }
+    usb_ep0_receive();
+}
+
+// Return the USB module to its state after a bus reset
+static void usb_reset(void)
+{
+    UIR = 0;                    // Clear USB interrupt flags
+    UADDR = 0;
+    for(unsigned char i = 0; i != 4; i++)
+    {
+        TRNIF = 0;              // Empty the USTAT FIFO
+    }
+    UEP1 = 0;
+    UEP2 = 0;
+    UEP0 = 0b00010110;          // EP0: handshake, control, IN and OUT
+    PPBRST = 1;
+    for(unsigned char bd = 0; bd != BD_COUNT; bd++)
+    {
+        usbBD[bd].STAT = 0;
+    }
+    usb_bd_address(BD_EP0_OUT, usbEP0Out);
+    usb_bd_address(BD_EP0_IN, usbEP0In);
+    usbConfiguration = 0;
+    usbPendingAddress = 0;
+    usbStage = CTRL_IDLE;
+    cdcDTR = false;
+    usb_ep0_receive();
+    PPBRST = 0;
+    PKTDIS = 0;
+}
+
+// Enable the USB module and its interrupt
+void USB_CDC_start(void)
+{
+    UCON = 0;                   // Disable the module (left on by the bootloader)
+    UIE = 0;
+    UCFG = 0b00010111;          // Pull-up on, full speed, ping-pong all but EP0
+    usb_reset();
+    UIE = 0b00001001;           // Interrupt on transactions and bus resets
+    USBEN = 1;                  // Attach to the bus
+    USBIF = 0;
+    USBIE = 1;                  // Enable the USB interrupt
+    PEIE = 1;                   // Enable peripheral interrupts
+    GIE = 1;                    // Enable global interrupts
+}
+
+// Return true once the device has been configured
+bool USB_CDC_ready(void)
+{
+    return (usbConfiguration != 0);
+}
+
+// Add a byte to the current IN buffer
+bool USB_CDC_write(unsigned char data)
+{
+    if(usbConfiguration == 0 || (usbBD[BD_EP2_IN + cdcInNext].STAT & BD_UOWN))
+    {
+        return (false);
+    }
+    usbEP2In[cdcInNext][cdcInCount] = data;
+    cdcInCount ++;
+    if(cdcInCount == USB_CDC_IN_SIZE)
+    {
+        USB_CDC_flush();
+    }
+    return (true);
+}
+
+// Send the current IN buffer. Even buffers are always sent as DATA0 packets
+// and odd buffers as DATA1 packets, since both alternate.
+void USB_CDC_flush(void)
+{
+    USB_bd_t *bd = &usbBD[BD_EP2_IN + cdcInNext];
+    
+    if(usbConfiguration == 0 || cdcInCount == 0 || (bd->STAT & BD_UOWN))
+    {
+        return;
+    }
+    bd->CNT = cdcInCount;
+    bd->STAT = BD_UOWN | BD_DTSEN | ((cdcInNext) ? BD_DTS : 0);
+    cdcInNext ^= 1;
+    cdcInCount = 0;
+}
+
+// Move ADC samples into the IN buffers while there is room
+unsigned char USB_CDC_send_samples(void)
+{
+    unsigned char samples = 0;
+    unsigned int sample;
+    
+    while(ADC_samples_available() != 0)
+    {
+        // Both bytes must fit, in this buffer or in the next one
+        if((usbBD[BD_EP2_IN + cdcInNext].STAT & BD_UOWN)
+                || (cdcInCount == USB_CDC_IN_SIZE - 1 && (usbBD[BD_EP2_IN + (cdcInNext ^ 1)].STAT & BD_UOWN)))
+        {
+            break;
+        }
+        sample = ADC_get_sample() >> 6;     // Left-justified to 10 bits
+        if(!USB_CDC_write((unsigned char)sample) || !USB_CDC_write((unsigned char)(sample >> 8)))
+        {
+            break;              // Not configured
+        }
+        samples ++;
+    }
+    return (samples);
+}
+
+// USB interrupt handler. Handle bus resets and endpoint 0 transactions, and
+// re-arm the bulk OUT buffers (received data is discarded).
+void USB_isr(void)
+{
+    unsigned char status;
+    
+    if(USBIF && USBIE)
+    {
+        USBIF = 0;
+        if(URSTIF)
+        {
+            usb_reset();
+        }
+        while(TRNIF)
+        {
+            status = USTAT;     // Read USTAT before clearing TRNIF, which
+            TRNIF = 0;          // moves the USTAT FIFO to the next transaction
+            if((status & 0b01111000) == 0)
+            {
+                usb_ep0_transaction(status & 0b00000100);
+            }
+            else if((status & 0b01111100) == 0b00010000)    // EP2 OUT
+            {
+                status = BD_EP2_OUT + ((status >> 1) & 1);  // Even or odd BD
+                usbBD[status].CNT = USB_CDC_OUT_SIZE;
+                usbBD[status].STAT = BD_UOWN;
+            }
+        }
+        UIR = UIR & 0b00001001; // Clear any other USB interrupt flags
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+/*==============================================================================
+ File:  USB-CDC.h
+ Date:  October 17, 2026
+ 
+ USB CDC-ACM (virtual serial port) function prototypes
+ 
+ A small full-speed USB device that appears to a computer as a serial port
+ (/dev/ttyACM0 on Linux, a COM port on Windows), for streaming sample data far
+ faster than the 9600 bps H1 output. Data is sent through bulk endpoint 2,
+ which uses two 64 byte ping-pong buffers so that one packet can be filled
+ while the other is being sent. Data sent to the device is discarded.
+ 
+ The USB device is only compiled in when USB_CDC is defined (below, or in the
+ project's XC8 compiler macros). Its buffer descriptors and endpoint buffers
+ use 240 bytes of the USB dual-port RAM at linear address 0x2000, so with the
+ Capture module's 256 byte buffer the program may not fit in RAM. Reduce
+ CAPTURE_SAMPLES if the linker can't place the buffers.
+ 
+ The device re-uses the 48 MHz clock and USB configuration bits set up for the
+ USB bootloader. Pressing SW1 still resets into the bootloader, which then
+ takes over the USB port.
+==============================================================================*/
+
+// Uncomment to enable the USB CDC device (or define USB_CDC in the compiler
+// macros)
+// #define USB_CDC
+
+// USB vendor and product IDs (Microchip CDC RS-232 emulation demo IDs, for
+// development use only)
+#define USB_VID         0x04D8
+#define USB_PID         0x000A
+
+// Endpoint sizes
+#define USB_EP0_SIZE    16          // Control endpoint packet size
+#define USB_CDC_IN_SIZE 64          // Bulk data IN packet size (each buffer)
+#define USB_CDC_OUT_SIZE 16         // Bulk data OUT packet size (each buffer)
+
+#ifdef USB_CDC
+
+/**
+ * Function: void USB_CDC_start(void)
+ * 
+ * Enable the USB module with its pull-up resistor, so that the computer
+ * detects the device, and enable the USB interrupt. Enumeration is handled
+ * by USB_isr().
+ */
+void USB_CDC_start(void);
+
+/**
+ * Function: bool USB_CDC_ready(void)
+ * 
+ * Return true once the computer has configured the device and data can be
+ * sent.
+ */
+bool USB_CDC_ready(void);
+
+/**
+ * Function: bool USB_CDC_write(unsigned char data)
+ * 
+ * Add a byte to the current IN buffer, and send the buffer when it is full.
+ * Returns false if the byte could not be added because the device is not
+ * configured or both buffers are waiting to be sent.
+ * 
+ * Example usage: USB_CDC_write('A');
+ */
+bool USB_CDC_write(unsigned char);
+
+/**
+ * Function: void USB_CDC_flush(void)
+ * 
+ * Send the current IN buffer, even if it isn't full. Call regularly (e.g.
+ * from a scheduler task) so that data doesn't wait in a partly filled buffer.
+ */
+void USB_CDC_flush(void);
+
+/**
+ * Function: unsigned char USB_CDC_send_samples(void)
+ * 
+ * Move samples from the ADC ring buffer into the IN buffers as 10-bit values,
+ * 2 bytes each (low byte first), for as long as there is room. Returns the
+ * number of samples moved. Use with ADC_start_timed_sampling().
+ * 
+ * Example usage: USB_CDC_send_samples();
+ */
+unsigned char USB_CDC_send_samples(void);
+
+/**
+ * Function: void USB_isr(void)
+ * 
+ * USB interrupt handler. Handles bus resets and control transfers on
+ * endpoint 0. Call from the interrupt service routine.
+ */
+void USB_isr(void);
+
+#endif